@@ -0,0 +1,269 @@
+#include "Gameplay/AI/Crowd/ShooterCrowdProxyActor.h"
+#include "Gameplay/Combat/ShooterCollisionChannels.h"
+#include "Gameplay/Net/ShooterPushModel.h"
+
+#include "Components/InstancedStaticMeshComponent.h"
+#include "Components/SceneComponent.h"
+#include "Engine/StaticMesh.h"
+#include "Engine/World.h"
+#include "Net/UnrealNetwork.h"
+
+static TAutoConsoleVariable<float> CVarCrowdNetUpdateHz(
+    TEXT("colosseum.Crowd.NetUpdateHz"),
+    10.f,
+    TEXT("Rate at which the server sends crowd entity positions to clients; clients extrapolate in between."),
+    ECVF_Cheat);
+
+static FTransform MakeEntityTransform(const FVector& Position, const FVector& Velocity)
+{
+    const FRotator Facing = Velocity.IsNearlyZero() ? FRotator::ZeroRotator : Velocity.Rotation();
+    return FTransform(Facing, Position);
+}
+
+AShooterCrowdProxyActor::AShooterCrowdProxyActor()
+{
+    // Ticks on clients only, to extrapolate between server updates
+    PrimaryActorTick.bCanEverTick = true;
+    PrimaryActorTick.bStartWithTickEnabled = false;
+
+    bReplicates = true;
+    bAlwaysRelevant = false;
+    SetNetUpdateFrequency(10.0f);
+    SetNetCullDistanceSquared(FMath::Square(20000.f));
+
+    RootComponent = CreateDefaultSubobject<USceneComponent>(TEXT("Root"));
+}
+
+void AShooterCrowdProxyActor::BeginPlay()
+{
+    Super::BeginPlay();
+
+    SetActorTickEnabled(!HasAuthority());
+}
+
+void AShooterCrowdProxyActor::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
+{
+    Super::GetLifetimeReplicatedProps(OutLifetimeProps);
+
+    FDoRepLifetimeParams Params;
+    Params.bIsPushBased = true;
+
+    DOREPLIFETIME_WITH_PARAMS_FAST(AShooterCrowdProxyActor, Meshes, Params);
+    DOREPLIFETIME_WITH_PARAMS_FAST(AShooterCrowdProxyActor, RepState, Params);
+}
+
+int32 AShooterCrowdProxyActor::FindOrAddMesh(UStaticMesh* Mesh)
+{
+    int32 Index = Meshes.IndexOfByKey(Mesh);
+    if (Index == INDEX_NONE && Meshes.Num() <= MAX_uint8)
+    {
+        Index = Meshes.Add(Mesh);
+        SHOOTER_MARK_DIRTY(AShooterCrowdProxyActor, Meshes, this);
+    }
+    return Index;
+}
+
+UInstancedStaticMeshComponent* AShooterCrowdProxyActor::GetOrCreateISM(int32 MeshIndex)
+{
+    if (!Meshes.IsValidIndex(MeshIndex) || !Meshes[MeshIndex])
+    {
+        return nullptr;
+    }
+
+    if (MeshComponents.Num() <= MeshIndex)
+    {
+        MeshComponents.SetNum(MeshIndex + 1);
+        InstanceEntityIds.SetNum(MeshIndex + 1);
+    }
+
+    if (MeshComponents[MeshIndex])
+    {
+        return MeshComponents[MeshIndex];
+    }
+
+    UInstancedStaticMeshComponent* ISM = NewObject<UInstancedStaticMeshComponent>(this);
+    ISM->SetStaticMesh(Meshes[MeshIndex]);
+    ISM->SetGenerateOverlapEvents(false);
+    ISM->SetCanEverAffectNavigation(false);
+
+    if (HasAuthority())
+    {
+        // Hit by weapon traces only; pawns walk through and client movement never sees the crowd
+        ISM->SetCollisionEnabled(ECollisionEnabled::QueryOnly);
+        ISM->SetCollisionObjectType(ECC_Pawn);
+        ISM->SetCollisionResponseToAllChannels(ECR_Ignore);
+        ISM->SetCollisionResponseToChannel(ECC_GameTraceChannel1, ECR_Block);
+        ISM->SetCollisionResponseToChannel(ECC_GameTraceChannel10, ECR_Block);
+        ISM->SetCollisionResponseToChannel(ShooterCollision::ArenaCombat, ECR_Block);
+    }
+    else
+    {
+        ISM->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+    }
+
+    ISM->SetupAttachment(RootComponent);
+    ISM->RegisterComponent();
+
+    MeshComponents[MeshIndex] = ISM;
+    return ISM;
+}
+
+void AShooterCrowdProxyActor::UpdateInstances(int32 MeshIndex, const TArray<FTransform>& Transforms)
+{
+    UInstancedStaticMeshComponent* ISM = GetOrCreateISM(MeshIndex);
+    if (!ISM)
+    {
+        return;
+    }
+
+    if (ISM->GetInstanceCount() == Transforms.Num())
+    {
+        if (Transforms.Num() > 0)
+        {
+            ISM->BatchUpdateInstancesTransforms(0, Transforms, true, true, true);
+        }
+        return;
+    }
+
+    // Count changed (spawn, promotion, death): rebuild the group in one go
+    ISM->ClearInstances();
+    if (Transforms.Num() > 0)
+    {
+        ISM->AddInstances(Transforms, false, true, false);
+    }
+}
+
+void AShooterCrowdProxyActor::SetEntities(const TArray<FShooterCrowdProxyEntity>& InEntities)
+{
+    TArray<TArray<FTransform>> TransformsByMesh;
+    TransformsByMesh.SetNum(Meshes.Num());
+
+    for (TArray<uint32>& Ids : InstanceEntityIds)
+    {
+        Ids.Reset();
+    }
+
+    TArray<int32> EntityMeshIndices;
+    EntityMeshIndices.Reserve(InEntities.Num());
+
+    for (const FShooterCrowdProxyEntity& Entity : InEntities)
+    {
+        const int32 MeshIndex = Entity.Mesh ? FindOrAddMesh(Entity.Mesh) : INDEX_NONE;
+        EntityMeshIndices.Add(MeshIndex);
+        if (MeshIndex == INDEX_NONE)
+        {
+            continue;
+        }
+
+        if (TransformsByMesh.Num() <= MeshIndex)
+        {
+            TransformsByMesh.SetNum(MeshIndex + 1);
+        }
+        if (InstanceEntityIds.Num() <= MeshIndex)
+        {
+            InstanceEntityIds.SetNum(MeshIndex + 1);
+        }
+
+        TransformsByMesh[MeshIndex].Add(MakeEntityTransform(Entity.Position, Entity.Velocity));
+        InstanceEntityIds[MeshIndex].Add(Entity.Id);
+    }
+
+    for (int32 MeshIndex = 0; MeshIndex < TransformsByMesh.Num(); ++MeshIndex)
+    {
+        UpdateInstances(MeshIndex, TransformsByMesh[MeshIndex]);
+    }
+
+    // --- Replication (rate-limited; clients extrapolate from velocity in between) ---
+    const double Now = GetWorld()->GetTimeSeconds();
+    const float Interval = 1.f / FMath::Max(CVarCrowdNetUpdateHz.GetValueOnGameThread(), 1.f);
+    if (LastPackTime >= 0.0 && Now - LastPackTime < Interval && RepState.Num() == InEntities.Num())
+    {
+        return;
+    }
+
+    LastPackTime = Now;
+
+    FShooterCrowdRepState Packed;
+    const FVector Origin = GetActorLocation();
+    for (int32 i = 0; i < InEntities.Num(); ++i)
+    {
+        if (EntityMeshIndices[i] != INDEX_NONE)
+        {
+            Packed.Add(InEntities[i].Position - Origin, InEntities[i].Velocity, (uint8)EntityMeshIndices[i]);
+        }
+    }
+
+    // Resting or empty crowds: clients already hold this state
+    if (Packed.SendsSameEntities(RepState))
+    {
+        return;
+    }
+
+    Packed.Revision = RepState.Revision + 1;
+    RepState = MoveTemp(Packed);
+    SHOOTER_MARK_DIRTY(AShooterCrowdProxyActor, RepState, this);
+}
+
+bool AShooterCrowdProxyActor::FindEntityId(const FHitResult& Hit, uint32& OutId) const
+{
+    const int32 MeshIndex = MeshComponents.IndexOfByKey(Cast<UInstancedStaticMeshComponent>(Hit.GetComponent()));
+    if (MeshIndex == INDEX_NONE || !InstanceEntityIds.IsValidIndex(MeshIndex) || !InstanceEntityIds[MeshIndex].IsValidIndex(Hit.Item))
+    {
+        return false;
+    }
+
+    OutId = InstanceEntityIds[MeshIndex][Hit.Item];
+    return true;
+}
+
+void AShooterCrowdProxyActor::OnRep_RepState()
+{
+    const FVector Origin = GetActorLocation();
+
+    ClientPositions.SetNumUninitialized(RepState.Num());
+    for (int32 i = 0; i < RepState.Num(); ++i)
+    {
+        ClientPositions[i] = Origin + RepState.Offsets[i];
+    }
+    ClientVelocities = RepState.Velocities;
+    ClientMeshIndices = RepState.MeshIndices;
+
+    UpdateClientInstances();
+}
+
+void AShooterCrowdProxyActor::Tick(float DeltaSeconds)
+{
+    Super::Tick(DeltaSeconds);
+
+    if (ClientPositions.Num() == 0)
+    {
+        return;
+    }
+
+    for (int32 i = 0; i < ClientPositions.Num(); ++i)
+    {
+        ClientPositions[i] += ClientVelocities[i] * DeltaSeconds;
+    }
+
+    UpdateClientInstances();
+}
+
+void AShooterCrowdProxyActor::UpdateClientInstances()
+{
+    TArray<TArray<FTransform>> TransformsByMesh;
+    TransformsByMesh.SetNum(FMath::Max(Meshes.Num(), MeshComponents.Num()));
+
+    for (int32 i = 0; i < ClientPositions.Num(); ++i)
+    {
+        // Meshes may arrive a bunch after the first state
+        if (TransformsByMesh.IsValidIndex(ClientMeshIndices[i]))
+        {
+            TransformsByMesh[ClientMeshIndices[i]].Add(MakeEntityTransform(ClientPositions[i], ClientVelocities[i]));
+        }
+    }
+
+    for (int32 MeshIndex = 0; MeshIndex < TransformsByMesh.Num(); ++MeshIndex)
+    {
+        UpdateInstances(MeshIndex, TransformsByMesh[MeshIndex]);
+    }
+}
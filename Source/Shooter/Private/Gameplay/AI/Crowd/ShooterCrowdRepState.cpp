@@ -0,0 +1,115 @@
+#include "Gameplay/AI/Crowd/ShooterCrowdRepState.h"
+
+#include "UObject/CoreNet.h"
+
+void FShooterCrowdRepState::Reset()
+{
+    Offsets.Reset();
+    Velocities.Reset();
+    MeshIndices.Reset();
+}
+
+void FShooterCrowdRepState::Add(const FVector& Offset, const FVector& Velocity, uint8 MeshIndex)
+{
+    Offsets.Add(Offset);
+    Velocities.Add(Velocity);
+    MeshIndices.Add(MeshIndex);
+}
+
+static int16 QuantizeAxis(double Value, float Step)
+{
+    return (int16)FMath::Clamp(FMath::RoundToInt(Value / Step), -32767, 32767);
+}
+
+/** One entity exactly as it goes on the wire */
+struct FQuantizedCrowdEntity
+{
+    int16 X = 0;
+    int16 Y = 0;
+    int16 Z = 0;
+    uint8 Yaw = 0;
+    uint8 Speed = 0;
+
+    FQuantizedCrowdEntity() = default;
+
+    FQuantizedCrowdEntity(const FVector& Offset, const FVector& Velocity)
+    {
+        X = QuantizeAxis(Offset.X, FShooterCrowdRepState::PositionStep);
+        Y = QuantizeAxis(Offset.Y, FShooterCrowdRepState::PositionStep);
+        Z = QuantizeAxis(Offset.Z, FShooterCrowdRepState::PositionStep);
+
+        const FVector Planar(Velocity.X, Velocity.Y, 0.f);
+        Yaw = FRotator::CompressAxisToByte(Planar.Rotation().Yaw);
+        Speed = (uint8)FMath::Clamp(FMath::RoundToInt(Planar.Size() / FShooterCrowdRepState::SpeedStep), 0, 255);
+    }
+
+    bool operator==(const FQuantizedCrowdEntity& Other) const
+    {
+        return X == Other.X && Y == Other.Y && Z == Other.Z && Yaw == Other.Yaw && Speed == Other.Speed;
+    }
+};
+
+bool FShooterCrowdRepState::SendsSameEntities(const FShooterCrowdRepState& Other) const
+{
+    if (Num() != Other.Num() || MeshIndices != Other.MeshIndices)
+    {
+        return false;
+    }
+
+    for (int32 i = 0; i < Num(); ++i)
+    {
+        if (!(FQuantizedCrowdEntity(Offsets[i], Velocities[i]) == FQuantizedCrowdEntity(Other.Offsets[i], Other.Velocities[i])))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+bool FShooterCrowdRepState::NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess)
+{
+    Ar.SerializeIntPacked(Revision);
+
+    uint32 Count = (uint32)FMath::Min(Num(), MaxEntities);
+    Ar.SerializeIntPacked(Count);
+
+    if (Ar.IsLoading())
+    {
+        if (Count > (uint32)MaxEntities)
+        {
+            Ar.SetError();
+            bOutSuccess = false;
+            return true;
+        }
+
+        Offsets.SetNumUninitialized(Count);
+        Velocities.SetNumUninitialized(Count);
+        MeshIndices.SetNumUninitialized(Count);
+    }
+
+    for (uint32 i = 0; i < Count; ++i)
+    {
+        FQuantizedCrowdEntity Entity;
+        if (Ar.IsSaving())
+        {
+            Entity = FQuantizedCrowdEntity(Offsets[i], Velocities[i]);
+        }
+
+        Ar << Entity.X;
+        Ar << Entity.Y;
+        Ar << Entity.Z;
+        Ar << Entity.Yaw;
+        Ar << Entity.Speed;
+        Ar << MeshIndices[i];
+
+        if (Ar.IsLoading())
+        {
+            Offsets[i] = FVector(Entity.X, Entity.Y, Entity.Z) * PositionStep;
+            Velocities[i] = FRotator(0.f, FRotator::DecompressAxisFromByte(Entity.Yaw), 0.f).Vector() * (Entity.Speed * SpeedStep);
+        }
+    }
+
+    bOutSuccess = !Ar.IsError();
+    return true;
+}
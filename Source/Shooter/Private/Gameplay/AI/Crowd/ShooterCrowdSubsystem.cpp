@@ -0,0 +1,458 @@
+#include "Gameplay/AI/Crowd/ShooterCrowdSubsystem.h"
+#include "Gameplay/AI/Crowd/ShooterCrowdProxyActor.h"
+#include "Gameplay/Arena/ArenaManager.h"
+#include "Gameplay/Arena/ShooterEnemyPoolSubsystem.h"
+#include "Gameplay/Abilities/AttrSet_Combat.h"
+#include "Gameplay/Characters/AI/ShooterAICharacter.h"
+#include "Gameplay/Characters/Player/ShooterCharacter.h"
+
+#include "AbilitySystemComponent.h"
+#include "Engine/World.h"
+#include "GameFramework/Pawn.h"
+#include "GameFramework/PlayerController.h"
+
+static TAutoConsoleVariable<float> CVarCrowdPromoteDistance(
+    TEXT("colosseum.Crowd.PromoteDistance"),
+    1800.f,
+    TEXT("Distance to the nearest player at which a crowd entity is promoted to a full enemy actor."),
+    ECVF_Cheat);
+
+static TAutoConsoleVariable<int32> CVarCrowdMaxPromotionsPerFrame(
+    TEXT("colosseum.Crowd.MaxPromotionsPerFrame"),
+    2,
+    TEXT("Maximum number of crowd entities promoted to full actors per frame."),
+    ECVF_Cheat);
+
+static TAutoConsoleVariable<float> CVarCrowdEngageRadius(
+    TEXT("colosseum.Crowd.EngageRadius"),
+    600.f,
+    TEXT("Crowd entities within this distance of a hit on the crowd are engaged (promoted regardless of player distance)."),
+    ECVF_Cheat);
+
+// --- Packed storage ---
+
+void FShooterCrowdEntities::Add(uint32 Id, const FVector& Position, float InHealth, float InMoveSpeed, int32 InArchetype, AArenaManager* Owner)
+{
+    Ids.Add(Id);
+    Positions.Add(Position);
+    Velocities.Add(FVector::ZeroVector);
+    Health.Add(InHealth);
+    SpawnHealth.Add(InHealth);
+    MoveSpeed.Add(InMoveSpeed);
+    Archetype.Add(InArchetype);
+    Engaged.Add(0);
+    Owners.Add(Owner);
+}
+
+void FShooterCrowdEntities::RemoveAtSwap(int32 Index)
+{
+    Ids.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+    Positions.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+    Velocities.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+    Health.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+    SpawnHealth.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+    MoveSpeed.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+    Archetype.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+    Engaged.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+    Owners.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+}
+
+void FShooterCrowdEntities::Reset()
+{
+    Ids.Reset();
+    Positions.Reset();
+    Velocities.Reset();
+    Health.Reset();
+    SpawnHealth.Reset();
+    MoveSpeed.Reset();
+    Archetype.Reset();
+    Engaged.Reset();
+    Owners.Reset();
+}
+
+// --- Subsystem ---
+
+void UShooterCrowdSubsystem::Deinitialize()
+{
+    Entities.Reset();
+    Archetypes.Empty();
+    Proxies.Empty();
+
+    Super::Deinitialize();
+}
+
+TStatId UShooterCrowdSubsystem::GetStatId() const
+{
+    RETURN_QUICK_DECLARE_CYCLE_STAT(UShooterCrowdSubsystem, STATGROUP_Tickables);
+}
+
+int32 UShooterCrowdSubsystem::FindOrAddArchetype(const FArenaCrowdSpawn& Spawn)
+{
+    const int32 Existing = Archetypes.IndexOfByPredicate([&Spawn](const FShooterCrowdArchetype& Arch)
+    {
+        return Arch.PromotedClass == Spawn.PromotedClass && Arch.ProxyMesh == Spawn.ProxyMesh;
+    });
+
+    if (Existing != INDEX_NONE)
+    {
+        return Existing;
+    }
+
+    FShooterCrowdArchetype& Arch = Archetypes.AddDefaulted_GetRef();
+    Arch.PromotedClass = Spawn.PromotedClass;
+    Arch.ProxyMesh = Spawn.ProxyMesh;
+    return Archetypes.Num() - 1;
+}
+
+int32 UShooterCrowdSubsystem::SpawnCrowd(AArenaManager* Owner, const FArenaCrowdSpawn& Spawn, const FVector& Center, float Radius)
+{
+    UWorld* World = GetWorld();
+    if (!World || World->GetNetMode() == NM_Client || !Owner)
+    {
+        return 0;
+    }
+
+    if (!Spawn.PromotedClass || Spawn.Count <= 0)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("ShooterCrowdSubsystem: Crowd spawn on %s has no PromotedClass or Count."), *GetNameSafe(Owner));
+        return 0;
+    }
+
+    if (!Spawn.ProxyMesh)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("ShooterCrowdSubsystem: Crowd spawn of %s on %s has no ProxyMesh; its entities are invisible and cannot be hit until promoted."),
+            *GetNameSafe(Spawn.PromotedClass), *GetNameSafe(Owner));
+    }
+
+    const int32 ArchetypeIndex = FindOrAddArchetype(Spawn);
+    GetOrCreateProxy(Owner);
+
+    for (int32 i = 0; i < Spawn.Count; ++i)
+    {
+        const FVector2D Offset = FMath::RandPointInCircle(Radius);
+        Entities.Add(NextEntityId++, Center + FVector(Offset.X, Offset.Y, 0.f), Spawn.Health, Spawn.MoveSpeed, ArchetypeIndex, Owner);
+    }
+
+    return Spawn.Count;
+}
+
+int32 UShooterCrowdSubsystem::GetNumEntitiesOwnedBy(const AArenaManager* Owner) const
+{
+    int32 Count = 0;
+    for (const TWeakObjectPtr<AArenaManager>& EntityOwner : Entities.Owners)
+    {
+        if (EntityOwner.Get() == Owner)
+        {
+            ++Count;
+        }
+    }
+    return Count;
+}
+
+int32 UShooterCrowdSubsystem::DamageEntitiesInRadius(const FVector& Center, float Radius, float Damage)
+{
+    const float RadiusSq = FMath::Square(Radius);
+    TArray<TWeakObjectPtr<AArenaManager>> OwnersToNotify;
+    int32 Killed = 0;
+
+    // Reverse iteration keeps RemoveAtSwap from skipping entities
+    for (int32 i = Entities.Num() - 1; i >= 0; --i)
+    {
+        if (FVector::DistSquared(Entities.Positions[i], Center) > RadiusSq)
+        {
+            continue;
+        }
+
+        Entities.Health[i] -= Damage;
+        if (Entities.Health[i] <= 0.f)
+        {
+            OwnersToNotify.AddUnique(Entities.Owners[i]);
+            Entities.RemoveAtSwap(i);
+            ++Killed;
+        }
+    }
+
+    // Notify after all removals: a cleared wave may immediately spawn new crowd entities
+    for (const TWeakObjectPtr<AArenaManager>& Owner : OwnersToNotify)
+    {
+        if (AArenaManager* Manager = Owner.Get())
+        {
+            Manager->OnCrowdEntitiesRemoved();
+        }
+    }
+
+    return Killed;
+}
+
+bool UShooterCrowdSubsystem::ApplyHitDamage(const FHitResult& Hit, float Damage)
+{
+    const AShooterCrowdProxyActor* Proxy = Cast<AShooterCrowdProxyActor>(Hit.GetActor());
+    if (!Proxy)
+    {
+        return false;
+    }
+
+    // Clients only draw the crowd; the server resolves the same shot
+    uint32 EntityId = 0;
+    if (!Proxy->HasAuthority() || !Proxy->FindEntityId(Hit, EntityId))
+    {
+        return true;
+    }
+
+    // Already promoted or killed earlier this frame
+    const int32 Index = Entities.Ids.IndexOfByKey(EntityId);
+    if (Index == INDEX_NONE)
+    {
+        return true;
+    }
+
+    // The shot draws the attention of the pack; survivors fight back as full enemies
+    EngageEntitiesInRadius(Hit.ImpactPoint, CVarCrowdEngageRadius.GetValueOnGameThread());
+
+    Entities.Health[Index] -= Damage;
+    if (Entities.Health[Index] <= 0.f)
+    {
+        AArenaManager* Owner = Entities.Owners[Index].Get();
+        Entities.RemoveAtSwap(Index);
+
+        if (Owner)
+        {
+            Owner->OnCrowdEntitiesRemoved();
+        }
+    }
+
+    return true;
+}
+
+void UShooterCrowdSubsystem::EngageEntitiesInRadius(const FVector& Center, float Radius)
+{
+    const float RadiusSq = FMath::Square(Radius);
+    for (int32 i = 0; i < Entities.Num(); ++i)
+    {
+        if (FVector::DistSquared(Entities.Positions[i], Center) <= RadiusSq)
+        {
+            Entities.Engaged[i] = 1;
+        }
+    }
+}
+
+void UShooterCrowdSubsystem::RemoveEntitiesOwnedBy(const AArenaManager* Owner)
+{
+    for (int32 i = Entities.Num() - 1; i >= 0; --i)
+    {
+        if (Entities.Owners[i].Get() == Owner)
+        {
+            Entities.RemoveAtSwap(i);
+        }
+    }
+
+    TWeakObjectPtr<AShooterCrowdProxyActor> Proxy;
+    if (Proxies.RemoveAndCopyValue(Owner, Proxy) && Proxy.IsValid())
+    {
+        Proxy->Destroy();
+    }
+}
+
+void UShooterCrowdSubsystem::SimulateEntities(float DeltaTime, const TArray<FVector>& PlayerLocations)
+{
+    const int32 Num = Entities.Num();
+    FVector* Positions = Entities.Positions.GetData();
+    FVector* Velocities = Entities.Velocities.GetData();
+    const float* Speeds = Entities.MoveSpeed.GetData();
+
+    for (int32 i = 0; i < Num; ++i)
+    {
+        // Seek the nearest player on the horizontal plane; Z stays at spawn height
+        float BestDistSq = TNumericLimits<float>::Max();
+        FVector Goal = Positions[i];
+        for (const FVector& PlayerLoc : PlayerLocations)
+        {
+            const float DistSq = FVector::DistSquared2D(Positions[i], PlayerLoc);
+            if (DistSq < BestDistSq)
+            {
+                BestDistSq = DistSq;
+                Goal = PlayerLoc;
+            }
+        }
+
+        const FVector ToGoal = FVector(Goal.X - Positions[i].X, Goal.Y - Positions[i].Y, 0.f);
+        Velocities[i] = ToGoal.GetSafeNormal() * Speeds[i];
+        Positions[i] += Velocities[i] * DeltaTime;
+    }
+}
+
+void UShooterCrowdSubsystem::PromoteEntity(int32 Index)
+{
+    UWorld* World = GetWorld();
+    AArenaManager* Owner = Entities.Owners[Index].Get();
+    const FShooterCrowdArchetype& Arch = Archetypes[Entities.Archetype[Index]];
+
+    if (!World || !Owner || !Arch.PromotedClass)
+    {
+        return;
+    }
+
+    const FVector Location = Entities.Positions[Index];
+    const FRotator Rotation = Entities.Velocities[Index].IsNearlyZero()
+        ? FRotator::ZeroRotator
+        : Entities.Velocities[Index].Rotation();
+
+    UShooterEnemyPoolSubsystem* Pool = World->GetSubsystem<UShooterEnemyPoolSubsystem>();
+    AShooterAICharacter* Enemy = Pool ? Pool->AcquireEnemy(Arch.PromotedClass, FTransform(Rotation, Location), Owner->GetArenaPlayer()) : nullptr;
+    if (Enemy)
+    {
+        // Carry crowd damage over as a fraction of the promoted enemy's max health
+        const float HealthFraction = Entities.Health[Index] / FMath::Max(Entities.SpawnHealth[Index], 1.f);
+        UAbilitySystemComponent* ASC = Enemy->GetAbilitySystemComponent();
+        if (ASC && HealthFraction < 1.f)
+        {
+            ASC->SetNumericAttributeBase(UAttrSet_Combat::GetHealthAttribute(), Enemy->GetMaxHealth() * HealthFraction);
+        }
+
+        Owner->RegisterPromotedEnemy(Enemy);
+    }
+    else
+    {
+        UE_LOG(LogTemp, Warning, TEXT("ShooterCrowdSubsystem: Failed to promote crowd entity to %s"), *GetNameSafe(Arch.PromotedClass));
+    }
+}
+
+void UShooterCrowdSubsystem::Tick(float DeltaTime)
+{
+    UWorld* World = GetWorld();
+    if (!World)
+    {
+        return;
+    }
+
+    if (Entities.Num() == 0)
+    {
+        // Flushes the last proxies once; empty groups are a no-op afterwards
+        UpdateProxies();
+        return;
+    }
+
+    // Drop entities whose arena went away
+    for (int32 i = Entities.Num() - 1; i >= 0; --i)
+    {
+        if (!Entities.Owners[i].IsValid())
+        {
+            Entities.RemoveAtSwap(i);
+        }
+    }
+
+    TArray<FVector> PlayerLocations;
+    for (FConstPlayerControllerIterator It = World->GetPlayerControllerIterator(); It; ++It)
+    {
+        const APlayerController* PC = It->Get();
+        if (const APawn* Pawn = PC ? PC->GetPawn() : nullptr)
+        {
+            PlayerLocations.Add(Pawn->GetActorLocation());
+        }
+    }
+
+    if (PlayerLocations.Num() > 0)
+    {
+        SimulateEntities(DeltaTime, PlayerLocations);
+    }
+
+    // --- Promotion (budgeted: spawning a full enemy is the expensive part) ---
+    const float PromoteDistSq = FMath::Square(CVarCrowdPromoteDistance.GetValueOnGameThread());
+    const int32 MaxPromotions = FMath::Max(0, CVarCrowdMaxPromotionsPerFrame.GetValueOnGameThread());
+
+    TArray<int32, TInlineAllocator<8>> ToPromote;
+    for (int32 i = 0; i < Entities.Num() && ToPromote.Num() < MaxPromotions; ++i)
+    {
+        bool bPromote = Entities.Engaged[i] != 0;
+        for (int32 p = 0; !bPromote && p < PlayerLocations.Num(); ++p)
+        {
+            bPromote = FVector::DistSquared(Entities.Positions[i], PlayerLocations[p]) <= PromoteDistSq;
+        }
+
+        if (bPromote)
+        {
+            ToPromote.Add(i);
+        }
+    }
+
+    TArray<TWeakObjectPtr<AArenaManager>> OwnersToNotify;
+
+    // Highest index first so RemoveAtSwap never moves a pending index
+    for (int32 k = ToPromote.Num() - 1; k >= 0; --k)
+    {
+        const int32 Index = ToPromote[k];
+        OwnersToNotify.AddUnique(Entities.Owners[Index]);
+        PromoteEntity(Index);
+        Entities.RemoveAtSwap(Index);
+    }
+
+    for (const TWeakObjectPtr<AArenaManager>& Owner : OwnersToNotify)
+    {
+        if (AArenaManager* Manager = Owner.Get())
+        {
+            Manager->OnCrowdEntitiesRemoved();
+        }
+    }
+
+    UpdateProxies();
+}
+
+AShooterCrowdProxyActor* UShooterCrowdSubsystem::GetOrCreateProxy(AArenaManager* Owner)
+{
+    if (TWeakObjectPtr<AShooterCrowdProxyActor>* Existing = Proxies.Find(Owner))
+    {
+        if (Existing->IsValid())
+        {
+            return Existing->Get();
+        }
+    }
+
+    FActorSpawnParameters Params;
+    Params.Owner = Owner;
+    Params.ObjectFlags |= RF_Transient;
+
+    // Entity offsets replicate relative to the proxy, so it sits at the arena origin
+    AShooterCrowdProxyActor* Proxy = GetWorld()->SpawnActor<AShooterCrowdProxyActor>(Owner->GetActorLocation(), FRotator::ZeroRotator, Params);
+    Proxies.Add(Owner, Proxy);
+    return Proxy;
+}
+
+void UShooterCrowdSubsystem::UpdateProxies()
+{
+    for (auto It = Proxies.CreateIterator(); It; ++It)
+    {
+        AShooterCrowdProxyActor* Proxy = It->Value.Get();
+        const AArenaManager* Owner = It->Key.ResolveObjectPtr();
+        if (!Owner || !Proxy)
+        {
+            if (Proxy)
+            {
+                Proxy->Destroy();
+            }
+            It.RemoveCurrent();
+            continue;
+        }
+
+        TArray<FShooterCrowdProxyEntity> ProxyEntities;
+        for (int32 i = 0; i < Entities.Num(); ++i)
+        {
+            UStaticMesh* Mesh = Archetypes[Entities.Archetype[i]].ProxyMesh;
+            if (Mesh && Entities.Owners[i].Get() == Owner)
+            {
+                FShooterCrowdProxyEntity& Entity = ProxyEntities.AddDefaulted_GetRef();
+                Entity.Id = Entities.Ids[i];
+                Entity.Position = Entities.Positions[i];
+                Entity.Velocity = Entities.Velocities[i];
+                Entity.Mesh = Mesh;
+            }
+        }
+
+        // Arena without crowd entities left: nothing to redraw or repack
+        if (ProxyEntities.Num() == 0 && Proxy->IsEmpty())
+        {
+            continue;
+        }
+
+        Proxy->SetEntities(ProxyEntities);
+    }
+}
@@ -2,62 +2,40 @@
 
 
 #include "Gameplay/AI/Services/BTService_CheckFlankOrRetreat.h"
-#include "Gameplay/Characters/AI/ShooterAICharacter.h"
-#include "Gameplay/Characters/ShooterCombatCharacter.h"
+#include "Gameplay/AI/ShooterAIDecisionSubsystem.h"
 
 #include "AIController.h"
-#include "BehaviorTree/BlackboardComponent.h"
-#include "Kismet/GameplayStatics.h"
-#include "GameplayCueManager.h"
 
 UBTService_CheckFlankOrRetreat::UBTService_CheckFlankOrRetreat()
 {
 	NodeName = TEXT("Check Flank or Retreat");
-	Interval = 0.5f;
-	RandomDeviation = 0.1f;
+	bNotifyTick = false;
+	bNotifyBecomeRelevant = true;
+	bNotifyCeaseRelevant = true;
 }
 
-void UBTService_CheckFlankOrRetreat::TickNode(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory, float DeltaSeconds)
+void UBTService_CheckFlankOrRetreat::OnBecomeRelevant(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory)
 {
-	Super::TickNode(OwnerComp, NodeMemory, DeltaSeconds);
+	Super::OnBecomeRelevant(OwnerComp, NodeMemory);
 
 	AAIController* Controller = OwnerComp.GetAIOwner();
 	if (!Controller) return;
 
-	AShooterAICharacter* Self = Cast<AShooterAICharacter>(Controller->GetPawn());
-	if (!Self) return;
-
-	UBlackboardComponent* BB = OwnerComp.GetBlackboardComponent();
-	if (!BB) return;
-
-	const float Health = Self->GetHealth();
-	const float MaxHealth = Self->GetMaxHealth();
-	const float HealthPercent = (MaxHealth > 0.f) ? (Health / MaxHealth) : 1.f;
-
-	// --- Retreat Logic
-	if (HealthPercent < 0.4f && !BB->GetValueAsBool(TEXT("bIsRetreating")))
+	if (UShooterAIDecisionSubsystem* Decisions = Controller->GetWorld()->GetSubsystem<UShooterAIDecisionSubsystem>())
 	{
-		BB->SetValueAsBool(TEXT("bIsRetreating"), true);
-		UGameplayCueManager::ExecuteGameplayCue_NonReplicated(Self, FGameplayTag::RequestGameplayTag(FName("GameplayCue.Enemy.Retreat")), FGameplayCueParameters());
-		return;
+		Decisions->EnableFlankOrRetreat(Controller, RetreatHealthPercent, FlankAllyRadius);
 	}
+}
 
-	// --- Flank Logic (skip if retreating)
-	if (!BB->GetValueAsBool(TEXT("bIsRetreating")))
+void UBTService_CheckFlankOrRetreat::OnCeaseRelevant(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory)
+{
+	AAIController* Controller = OwnerComp.GetAIOwner();
+	UWorld* World = Controller ? Controller->GetWorld() : nullptr;
+
+	if (UShooterAIDecisionSubsystem* Decisions = World ? World->GetSubsystem<UShooterAIDecisionSubsystem>() : nullptr)
 	{
-		TArray<AActor*> Allies;
-		UGameplayStatics::GetAllActorsOfClass(Self->GetWorld(), AShooterAICharacter::StaticClass(), Allies);
-
-		for (AActor* Ally : Allies)
-		{
-			if (Ally != Self && FVector::Dist(Self->GetActorLocation(), Ally->GetActorLocation()) < 800.f)
-			{
-				BB->SetValueAsBool(TEXT("bIsFlanking"), true);
-				UGameplayCueManager::ExecuteGameplayCue_NonReplicated(Self, FGameplayTag::RequestGameplayTag(FName("GameplayCue.Enemy.Flank")), FGameplayCueParameters());
-				return;
-			}
-		}
-
-		BB->SetValueAsBool(TEXT("bIsFlanking"), false);
+		Decisions->DisableDecision(Controller, EShooterAIDecision::FlankOrRetreat);
 	}
+
+	Super::OnCeaseRelevant(OwnerComp, NodeMemory);
 }
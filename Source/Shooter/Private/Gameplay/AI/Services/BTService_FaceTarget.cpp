@@ -2,41 +2,40 @@
 
 
 #include "Gameplay/AI/Services/BTService_FaceTarget.h"
+#include "Gameplay/AI/ShooterAIDecisionSubsystem.h"
 
 #include "AIController.h"
-#include "GameFramework/Character.h"
-#include "BehaviorTree/BlackboardComponent.h"
 
 UBTService_FaceTarget::UBTService_FaceTarget()
 {
     NodeName = TEXT("Face Target");
+    bNotifyTick = false;
     bNotifyBecomeRelevant = true;
-    bNotifyCeaseRelevant = false;
-    Interval = 0.1f; // tick every 0.1s
+    bNotifyCeaseRelevant = true;
 }
 
-void UBTService_FaceTarget::TickNode(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory, float DeltaSeconds)
+void UBTService_FaceTarget::OnBecomeRelevant(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory)
 {
-    Super::TickNode(OwnerComp, NodeMemory, DeltaSeconds);
+    Super::OnBecomeRelevant(OwnerComp, NodeMemory);
 
     AAIController* AIC = OwnerComp.GetAIOwner();
     if (!AIC) return;
 
-    APawn* Pawn = AIC->GetPawn();
-    if (!Pawn) return;
-
-    UBlackboardComponent* BB = OwnerComp.GetBlackboardComponent();
-    if (!BB) return;
-
-    AActor* Target = Cast<AActor>(BB->GetValueAsObject(GetSelectedBlackboardKey()));
-    if (!Target) return;
+    if (UShooterAIDecisionSubsystem* Decisions = AIC->GetWorld()->GetSubsystem<UShooterAIDecisionSubsystem>())
+    {
+        Decisions->EnableFaceTarget(AIC, GetSelectedBlackboardKey());
+    }
+}
 
-    FVector Direction = (Target->GetActorLocation() - Pawn->GetActorLocation());
-    Direction.Z = 0.f;
+void UBTService_FaceTarget::OnCeaseRelevant(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory)
+{
+    AAIController* AIC = OwnerComp.GetAIOwner();
+    UWorld* World = AIC ? AIC->GetWorld() : nullptr;
 
-    if (!Direction.IsNearlyZero())
+    if (UShooterAIDecisionSubsystem* Decisions = World ? World->GetSubsystem<UShooterAIDecisionSubsystem>() : nullptr)
     {
-        FRotator NewRot = Direction.Rotation();
-        Pawn->SetActorRotation(NewRot);
+        Decisions->DisableDecision(AIC, EShooterAIDecision::FaceTarget);
     }
+
+    Super::OnCeaseRelevant(OwnerComp, NodeMemory);
 }
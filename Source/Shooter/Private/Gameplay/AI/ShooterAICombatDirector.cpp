@@ -0,0 +1,158 @@
+#include "Gameplay/AI/ShooterAICombatDirector.h"
+#include "Gameplay/Characters/AI/ShooterAICharacter.h"
+
+#include "Engine/World.h"
+
+static TAutoConsoleVariable<int32> CVarAIMaxAttackers(
+    TEXT("colosseum.AI.MaxAttackers"),
+    4,
+    TEXT("Maximum number of AI enemies allowed to attack at the same time (attack tokens)."),
+    ECVF_Cheat);
+
+static TAutoConsoleVariable<int32> CVarAIMaxAttacksPerFrame(
+    TEXT("colosseum.AI.MaxAttacksPerFrame"),
+    6,
+    TEXT("Maximum number of due AI attackers the combat director processes per frame."),
+    ECVF_Cheat);
+
+static TAutoConsoleVariable<float> CVarAIAttackTokenDuration(
+    TEXT("colosseum.AI.AttackTokenDuration"),
+    0.6f,
+    TEXT("Seconds an attack token stays held after an enemy attacks."),
+    ECVF_Cheat);
+
+static TAutoConsoleVariable<float> CVarAIAttackRetryDelay(
+    TEXT("colosseum.AI.AttackRetryDelay"),
+    0.25f,
+    TEXT("Seconds before re-checking an enemy that could not attack (no token or out of range)."),
+    ECVF_Cheat);
+
+void UShooterAICombatDirector::Deinitialize()
+{
+    Schedule.Empty();
+    TokenReleaseTimes.Empty();
+
+    Super::Deinitialize();
+}
+
+TStatId UShooterAICombatDirector::GetStatId() const
+{
+    RETURN_QUICK_DECLARE_CYCLE_STAT(UShooterAICombatDirector, STATGROUP_Tickables);
+}
+
+void UShooterAICombatDirector::RegisterAttacker(AShooterAICharacter* Agent)
+{
+    UWorld* World = GetWorld();
+    if (!Agent || !World)
+    {
+        return;
+    }
+
+    const bool bAlreadyRegistered = Schedule.ContainsByPredicate(
+        [Agent](const FShooterScheduledAttacker& Entry) { return Entry.Agent.Get() == Agent; });
+
+    if (bAlreadyRegistered)
+    {
+        return;
+    }
+
+    // Jitter the first attack across one interval so a wave spawned in one frame stays desynchronized
+    FShooterScheduledAttacker Entry;
+    Entry.Agent = Agent;
+    Entry.NextAttackTime = World->GetTimeSeconds() + FMath::FRandRange(0.f, Agent->GetAttackInterval());
+
+    Schedule.HeapPush(Entry);
+}
+
+void UShooterAICombatDirector::UnregisterAttacker(AShooterAICharacter* Agent)
+{
+    const int32 Removed = Schedule.RemoveAll(
+        [Agent](const FShooterScheduledAttacker& Entry) { return !Entry.Agent.IsValid() || Entry.Agent.Get() == Agent; });
+
+    if (Removed > 0)
+    {
+        Schedule.Heapify();
+    }
+}
+
+void UShooterAICombatDirector::ReleaseExpiredTokens(double Now)
+{
+    for (auto It = TokenReleaseTimes.CreateIterator(); It; ++It)
+    {
+        It.Value().RemoveAllSwap([Now](double ReleaseTime) { return ReleaseTime <= Now; });
+        if (It.Value().Num() == 0)
+        {
+            It.RemoveCurrent();
+        }
+    }
+}
+
+int32 UShooterAICombatDirector::GetNumActiveAttackTokens() const
+{
+    int32 Total = 0;
+    for (const TPair<TObjectKey<AActor>, TArray<double>>& Pair : TokenReleaseTimes)
+    {
+        Total += Pair.Value.Num();
+    }
+    return Total;
+}
+
+void UShooterAICombatDirector::Tick(float DeltaTime)
+{
+    UWorld* World = GetWorld();
+    if (!World || Schedule.Num() == 0)
+    {
+        return;
+    }
+
+    const double Now = World->GetTimeSeconds();
+
+    // Nothing due yet: the heap top is the earliest attacker
+    if (Schedule.HeapTop().NextAttackTime > Now)
+    {
+        return;
+    }
+
+    ReleaseExpiredTokens(Now);
+
+    const int32 MaxAttackers = FMath::Max(0, CVarAIMaxAttackers.GetValueOnGameThread());
+    const int32 MaxPerFrame = FMath::Max(1, CVarAIMaxAttacksPerFrame.GetValueOnGameThread());
+    const float TokenDuration = CVarAIAttackTokenDuration.GetValueOnGameThread();
+    const float RetryDelay = CVarAIAttackRetryDelay.GetValueOnGameThread();
+
+    int32 Processed = 0;
+    while (Schedule.Num() > 0 && Processed < MaxPerFrame && Schedule.HeapTop().NextAttackTime <= Now)
+    {
+        FShooterScheduledAttacker Entry;
+        Schedule.HeapPop(Entry, EAllowShrinking::No);
+
+        AShooterAICharacter* Agent = Entry.Agent.Get();
+        if (!Agent || Agent->IsDead())
+        {
+            // Dead or destroyed agents drop out of the schedule
+            continue;
+        }
+
+        ++Processed;
+
+        // Each agent fights its own arena's player
+        const AActor* Target = Agent->GetCombatTarget();
+        TArray<double>* TargetTokens = Target ? &TokenReleaseTimes.FindOrAdd(TObjectKey<AActor>(Target)) : nullptr;
+
+        if (!TargetTokens || TargetTokens->Num() >= MaxAttackers)
+        {
+            Entry.NextAttackTime = Now + RetryDelay;
+        }
+        else if (Agent->PerformScheduledAttack(Target))
+        {
+            TargetTokens->Add(Now + TokenDuration);
+            Entry.NextAttackTime = Now + Agent->GetAttackInterval();
+        }
+        else
+        {
+            Entry.NextAttackTime = Now + RetryDelay;
+        }
+
+        Schedule.HeapPush(Entry);
+    }
+}
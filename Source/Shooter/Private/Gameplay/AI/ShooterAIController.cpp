@@ -1,8 +1,10 @@
 #include "Gameplay/AI/Controller/ShooterAIController.h"
 #include "Gameplay/Characters/Player/ShooterCharacter.h"
+#include "Gameplay/Characters/AI/ShooterAICharacter.h"
 
 #include "BehaviorTree/BlackboardComponent.h"
 #include "BehaviorTree/BehaviorTreeComponent.h"
+#include "BrainComponent.h"
 #include "Kismet/GameplayStatics.h"
 
 AShooterAIController::AShooterAIController()
@@ -19,6 +21,71 @@ void AShooterAIController::BeginPlay()
         RunBehaviorTree(BehaviorTreeAsset);
     }
 
+    // Spawned controllers begin play before possessing; OnPossess picks those up
+    if (GetPawn())
+    {
+        InitializeCombatState();
+    }
+}
+
+void AShooterAIController::OnPossess(APawn* InPawn)
+{
+    Super::OnPossess(InPawn);
+
+    if (HasActorBegunPlay())
+    {
+        InitializeCombatState();
+    }
+}
+
+AActor* AShooterAIController::ResolveCombatTarget() const
+{
+    if (const AShooterAICharacter* Agent = Cast<AShooterAICharacter>(GetPawn()))
+    {
+        return Agent->GetCombatTarget();
+    }
+
+    return UGameplayStatics::GetPlayerPawn(GetWorld(), 0);
+}
+
+void AShooterAIController::SetCombatTarget(AActor* Target)
+{
+    if (UBlackboardComponent* BB = GetBlackboardComponent())
+    {
+        BB->SetValueAsObject(FName("TargetActor"), Target);
+    }
+}
+
+void AShooterAIController::PauseForPool()
+{
+    StopMovement();
+    ClearFocus(EAIFocusPriority::Gameplay);
+    GetWorldTimerManager().ClearAllTimersForObject(this);
+
+    if (UBrainComponent* Brain = GetBrainComponent())
+    {
+        Brain->StopLogic(TEXT("Pooled"));
+    }
+}
+
+void AShooterAIController::RestartCombatLogic()
+{
+    if (UBlackboardComponent* BB = GetBlackboardComponent())
+    {
+        BB->SetValueAsBool(FName("bIsRetreating"), false);
+        BB->SetValueAsBool(FName("bIsFlanking"), false);
+        BB->SetValueAsBool(FName("bReadyToAttack"), false);
+    }
+
+    if (UBrainComponent* Brain = GetBrainComponent())
+    {
+        Brain->RestartLogic();
+    }
+    else if (BehaviorTreeAsset)
+    {
+        RunBehaviorTree(BehaviorTreeAsset);
+    }
+
     InitializeCombatState();
 }
 
@@ -31,8 +98,8 @@ void AShooterAIController::InitializeCombatState()
         return;
     }
 
-    // Acquire player pawn immediately
-    APawn* PlayerPawn = UGameplayStatics::GetPlayerPawn(GetWorld(), 0);
+    // Acquire the arena's player immediately
+    AActor* PlayerPawn = ResolveCombatTarget();
     if (!PlayerPawn)
     {
         UE_LOG(LogTemp, Warning, TEXT("ShooterAIController: No player pawn found."));
@@ -52,14 +119,15 @@ void AShooterAIController::InitializeCombatState()
     FTimerHandle TimerHandle;
     GetWorldTimerManager().SetTimer(
         TimerHandle,
-        [this, PlayerPawn]()
+        [this]()
         {
             if (UBlackboardComponent* BBRef = GetBlackboardComponent())
             {
-                // Ensure target still valid
-                if (IsValid(PlayerPawn))
+                // Re-resolve: the target may have been reassigned (or respawned) during the delay
+                AActor* Target = ResolveCombatTarget();
+                if (IsValid(Target))
                 {
-                    BBRef->SetValueAsObject(FName("TargetActor"), PlayerPawn);
+                    BBRef->SetValueAsObject(FName("TargetActor"), Target);
                     BBRef->SetValueAsBool(FName("bReadyToAttack"), true);
                 }
             }
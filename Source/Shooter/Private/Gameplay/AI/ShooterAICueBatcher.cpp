@@ -0,0 +1,121 @@
+#include "Gameplay/AI/ShooterAICueBatcher.h"
+
+#include "Engine/World.h"
+#include "GameFramework/PlayerController.h"
+#include "GameplayCueManager.h"
+
+static TAutoConsoleVariable<int32> CVarCueMaxPerFrame(
+    TEXT("colosseum.Cue.MaxPerFrame"),
+    8,
+    TEXT("Maximum number of batched AI gameplay cues executed per frame."),
+    ECVF_Cheat);
+
+static TAutoConsoleVariable<float> CVarCueMaxDistance(
+    TEXT("colosseum.Cue.MaxDistance"),
+    5000.f,
+    TEXT("Batched AI gameplay cues farther than this from every local viewer are skipped."),
+    ECVF_Cheat);
+
+void UShooterAICueBatcher::Deinitialize()
+{
+    PendingCues.Empty();
+
+    Super::Deinitialize();
+}
+
+TStatId UShooterAICueBatcher::GetStatId() const
+{
+    RETURN_QUICK_DECLARE_CYCLE_STAT(UShooterAICueBatcher, STATGROUP_Tickables);
+}
+
+void UShooterAICueBatcher::QueueCue(AActor* Target, const FGameplayTag& CueTag, const FGameplayCueParameters& Parameters)
+{
+    UWorld* World = GetWorld();
+    if (!Target || !CueTag.IsValid() || !World || World->GetNetMode() == NM_DedicatedServer)
+    {
+        return;
+    }
+
+    // Same cue on the same actor this frame: keep the first request
+    const bool bAlreadyQueued = PendingCues.ContainsByPredicate([Target, &CueTag](const FShooterPendingCue& Cue)
+    {
+        return Cue.CueTag == CueTag && Cue.Target.Get() == Target;
+    });
+
+    if (bAlreadyQueued)
+    {
+        return;
+    }
+
+    FShooterPendingCue& Cue = PendingCues.AddDefaulted_GetRef();
+    Cue.Target = Target;
+    Cue.CueTag = CueTag;
+    Cue.Parameters = Parameters;
+}
+
+void UShooterAICueBatcher::GatherViewerLocations(TArray<FVector>& OutLocations) const
+{
+    for (FConstPlayerControllerIterator It = GetWorld()->GetPlayerControllerIterator(); It; ++It)
+    {
+        const APlayerController* PC = It->Get();
+        if (PC && PC->IsLocalController())
+        {
+            FVector ViewLocation;
+            FRotator ViewRotation;
+            PC->GetPlayerViewPoint(ViewLocation, ViewRotation);
+            OutLocations.Add(ViewLocation);
+        }
+    }
+}
+
+void UShooterAICueBatcher::Tick(float DeltaTime)
+{
+    if (PendingCues.Num() == 0)
+    {
+        return;
+    }
+
+    TArray<FVector> Viewers;
+    GatherViewerLocations(Viewers);
+
+    const float MaxDistSq = FMath::Square(CVarCueMaxDistance.GetValueOnGameThread());
+    const int32 MaxPerFrame = FMath::Max(0, CVarCueMaxPerFrame.GetValueOnGameThread());
+
+    // Score by distance to the nearest viewer and drop out-of-range or stale cues
+    for (int32 i = PendingCues.Num() - 1; i >= 0; --i)
+    {
+        FShooterPendingCue& Cue = PendingCues[i];
+        const AActor* Target = Cue.Target.Get();
+        if (!Target || Viewers.Num() == 0)
+        {
+            PendingCues.RemoveAtSwap(i, 1, EAllowShrinking::No);
+            continue;
+        }
+
+        Cue.ViewerDistSq = TNumericLimits<float>::Max();
+        for (const FVector& Viewer : Viewers)
+        {
+            Cue.ViewerDistSq = FMath::Min(Cue.ViewerDistSq, static_cast<float>(FVector::DistSquared(Viewer, Target->GetActorLocation())));
+        }
+
+        if (Cue.ViewerDistSq > MaxDistSq)
+        {
+            PendingCues.RemoveAtSwap(i, 1, EAllowShrinking::No);
+        }
+    }
+
+    PendingCues.Sort([](const FShooterPendingCue& A, const FShooterPendingCue& B)
+    {
+        return A.ViewerDistSq < B.ViewerDistSq;
+    });
+
+    // Cues are cosmetic: whatever misses this frame's budget is dropped, not carried over
+    const int32 NumToRun = FMath::Min(MaxPerFrame, PendingCues.Num());
+    for (int32 i = 0; i < NumToRun; ++i)
+    {
+        FShooterPendingCue& Cue = PendingCues[i];
+        UGameplayCueManager::ExecuteGameplayCue_NonReplicated(Cue.Target.Get(), Cue.CueTag, Cue.Parameters);
+    }
+
+    PendingCues.Reset();
+}
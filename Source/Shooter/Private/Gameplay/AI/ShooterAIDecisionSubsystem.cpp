@@ -0,0 +1,311 @@
+#include "Gameplay/AI/ShooterAIDecisionSubsystem.h"
+#include "Gameplay/AI/ShooterAICueBatcher.h"
+#include "Gameplay/Characters/AI/ShooterAICharacter.h"
+#include "Gameplay/Combat/ShooterCombatEventSubsystem.h"
+#include "Gameplay/Tags/ShooterGameplayTags.h"
+
+#include "AIController.h"
+#include "Async/ParallelFor.h"
+#include "BehaviorTree/BlackboardComponent.h"
+
+static TAutoConsoleVariable<float> CVarAIDecisionInterval(
+    TEXT("colosseum.AI.DecisionInterval"),
+    0.1f,
+    TEXT("Seconds between batched AI decision phases (flank/retreat, facing)."),
+    ECVF_Cheat);
+
+static TAutoConsoleVariable<int32> CVarAIDecisionMinParallelAgents(
+    TEXT("colosseum.AI.DecisionMinParallelAgents"),
+    16,
+    TEXT("Below this many agents the decision phase runs single-threaded."),
+    ECVF_Cheat);
+
+namespace ShooterAIDecisionKeys
+{
+    static const FName IsRetreating(TEXT("bIsRetreating"));
+    static const FName IsFlanking(TEXT("bIsFlanking"));
+}
+
+void UShooterAIDecisionSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+    Super::Initialize(Collection);
+
+    if (UShooterCombatEventSubsystem* Events = Collection.InitializeDependency<UShooterCombatEventSubsystem>())
+    {
+        Events->OnHealthChanged.AddDynamic(this, &UShooterAIDecisionSubsystem::OnCombatHealthChanged);
+        Events->OnHealthDepleted.AddDynamic(this, &UShooterAIDecisionSubsystem::OnCombatHealthDepleted);
+    }
+}
+
+void UShooterAIDecisionSubsystem::Deinitialize()
+{
+    Agents.Empty();
+    Inputs.Empty();
+    Outputs.Empty();
+    HealthFractions.Empty();
+
+    Super::Deinitialize();
+}
+
+TStatId UShooterAIDecisionSubsystem::GetStatId() const
+{
+    RETURN_QUICK_DECLARE_CYCLE_STAT(UShooterAIDecisionSubsystem, STATGROUP_Tickables);
+}
+
+FShooterAIDecisionAgent& UShooterAIDecisionSubsystem::FindOrAddAgent(AAIController* Controller)
+{
+    if (FShooterAIDecisionAgent* Existing = Agents.FindByPredicate(
+        [Controller](const FShooterAIDecisionAgent& Agent) { return Agent.Controller.Get() == Controller; }))
+    {
+        TrackAgentPawn(*Existing);
+        return *Existing;
+    }
+
+    FShooterAIDecisionAgent& Agent = Agents.AddDefaulted_GetRef();
+    Agent.Controller = Controller;
+    TrackAgentPawn(Agent);
+    return Agent;
+}
+
+void UShooterAIDecisionSubsystem::TrackAgentPawn(FShooterAIDecisionAgent& Agent)
+{
+    const AAIController* Controller = Agent.Controller.Get();
+    APawn* Pawn = Controller ? Controller->GetPawn() : nullptr;
+    if (!Pawn || TObjectKey<APawn>(Pawn) == Agent.Pawn)
+    {
+        return;
+    }
+
+    HealthFractions.Remove(Agent.Pawn);
+    Agent.Pawn = Pawn;
+
+    // Damage taken before registration was published while nobody listened: read it once
+    const AShooterCombatCharacter* Character = Cast<AShooterCombatCharacter>(Pawn);
+    const float MaxHealth = Character ? Character->GetMaxHealth() : 0.f;
+    HealthFractions.Add(Pawn, MaxHealth > 0.f ? FMath::Clamp(Character->GetHealth() / MaxHealth, 0.f, 1.f) : 1.f);
+}
+
+void UShooterAIDecisionSubsystem::EnableFlankOrRetreat(AAIController* Controller, float RetreatHealthPercent, float FlankAllyRadius)
+{
+    if (!Controller)
+    {
+        return;
+    }
+
+    FShooterAIDecisionAgent& Agent = FindOrAddAgent(Controller);
+    Agent.Decisions |= EShooterAIDecision::FlankOrRetreat;
+    Agent.RetreatHealthPercent = RetreatHealthPercent;
+    Agent.FlankAllyRadius = FlankAllyRadius;
+}
+
+void UShooterAIDecisionSubsystem::EnableFaceTarget(AAIController* Controller, FName TargetKey)
+{
+    if (!Controller)
+    {
+        return;
+    }
+
+    FShooterAIDecisionAgent& Agent = FindOrAddAgent(Controller);
+    Agent.Decisions |= EShooterAIDecision::FaceTarget;
+    Agent.FaceTargetKey = TargetKey;
+}
+
+void UShooterAIDecisionSubsystem::DisableDecision(AAIController* Controller, EShooterAIDecision Decision)
+{
+    const int32 Index = Agents.IndexOfByPredicate(
+        [Controller](const FShooterAIDecisionAgent& Agent) { return Agent.Controller.Get() == Controller; });
+
+    if (Index == INDEX_NONE)
+    {
+        return;
+    }
+
+    // Only clear the flag: blackboard writes in ApplyDecisions can abort BT branches and land here
+    // mid-loop, so agents with no decisions left are pruned at the start of the next phase instead
+    Agents[Index].Decisions &= ~Decision;
+}
+
+void UShooterAIDecisionSubsystem::Tick(float DeltaTime)
+{
+    TimeSinceLastDecision += DeltaTime;
+    if (TimeSinceLastDecision < CVarAIDecisionInterval.GetValueOnGameThread())
+    {
+        return;
+    }
+    TimeSinceLastDecision = 0.f;
+
+    // Drop agents whose controller or pawn went away, or that opted out of every decision, with their health entry
+    Agents.RemoveAllSwap([this](const FShooterAIDecisionAgent& Agent)
+    {
+        const AAIController* Controller = Agent.Controller.Get();
+        const bool bRemove = !Controller || !Controller->GetPawn() || Agent.Decisions == EShooterAIDecision::None;
+        if (bRemove)
+        {
+            HealthFractions.Remove(Agent.Pawn);
+        }
+        return bRemove;
+    });
+
+    if (Agents.Num() == 0)
+    {
+        return;
+    }
+
+    GatherSnapshot();
+    EvaluateDecisions();
+    ApplyDecisions();
+}
+
+void UShooterAIDecisionSubsystem::GatherSnapshot()
+{
+    Inputs.SetNum(Agents.Num(), EAllowShrinking::No);
+    Outputs.SetNum(Agents.Num(), EAllowShrinking::No);
+
+    for (int32 i = 0; i < Agents.Num(); ++i)
+    {
+        const FShooterAIDecisionAgent& Agent = Agents[i];
+        AAIController* Controller = Agent.Controller.Get();
+        const APawn* Pawn = Controller->GetPawn();
+        const UBlackboardComponent* BB = Controller->GetBlackboardComponent();
+
+        FShooterAIDecisionInput& In = Inputs[i];
+        In = FShooterAIDecisionInput();
+        In.Location = Pawn->GetActorLocation();
+        In.Decisions = Agent.Decisions;
+        In.RetreatHealthPercent = Agent.RetreatHealthPercent;
+        In.FlankAllyRadiusSq = FMath::Square(Agent.FlankAllyRadius);
+
+        if (const float* HealthFraction = HealthFractions.Find(Pawn))
+        {
+            In.HealthPercent = *HealthFraction;
+        }
+
+        if (BB)
+        {
+            In.bWasRetreating = BB->GetValueAsBool(ShooterAIDecisionKeys::IsRetreating);
+            In.bWasFlanking = BB->GetValueAsBool(ShooterAIDecisionKeys::IsFlanking);
+
+            if (EnumHasAnyFlags(Agent.Decisions, EShooterAIDecision::FaceTarget))
+            {
+                if (const AActor* Target = Cast<AActor>(BB->GetValueAsObject(Agent.FaceTargetKey)))
+                {
+                    In.FaceTargetLocation = Target->GetActorLocation();
+                    In.bHasFaceTarget = true;
+                }
+            }
+        }
+    }
+}
+
+void UShooterAIDecisionSubsystem::EvaluateDecisions()
+{
+    const int32 Num = Inputs.Num();
+    const TArray<FShooterAIDecisionInput>& In = Inputs;
+    TArray<FShooterAIDecisionOutput>& Out = Outputs;
+
+    const EParallelForFlags Flags = Num < CVarAIDecisionMinParallelAgents.GetValueOnGameThread()
+        ? EParallelForFlags::ForceSingleThread
+        : EParallelForFlags::None;
+
+    // Workers only read the snapshot and write their own output slot
+    ParallelFor(Num, [&In, &Out, Num](int32 Index)
+    {
+        const FShooterAIDecisionInput& Self = In[Index];
+        FShooterAIDecisionOutput& Result = Out[Index];
+        Result = FShooterAIDecisionOutput();
+        Result.bRetreating = Self.bWasRetreating;
+        Result.bFlanking = Self.bWasFlanking;
+
+        if (EnumHasAnyFlags(Self.Decisions, EShooterAIDecision::FlankOrRetreat))
+        {
+            // Retreat is sticky once triggered
+            Result.bRetreating = Self.bWasRetreating || Self.HealthPercent < Self.RetreatHealthPercent;
+
+            if (!Result.bRetreating)
+            {
+                bool bAllyNearby = false;
+                for (int32 Other = 0; Other < Num && !bAllyNearby; ++Other)
+                {
+                    bAllyNearby = Other != Index && FVector::DistSquared(Self.Location, In[Other].Location) < Self.FlankAllyRadiusSq;
+                }
+                Result.bFlanking = bAllyNearby;
+            }
+        }
+
+        if (Self.bHasFaceTarget)
+        {
+            const FVector Direction(Self.FaceTargetLocation.X - Self.Location.X, Self.FaceTargetLocation.Y - Self.Location.Y, 0.f);
+            if (!Direction.IsNearlyZero())
+            {
+                Result.Facing = Direction.Rotation();
+                Result.bApplyFacing = true;
+            }
+        }
+    }, Flags);
+}
+
+void UShooterAIDecisionSubsystem::ApplyDecisions()
+{
+    UShooterAICueBatcher* CueBatcher = GetWorld()->GetSubsystem<UShooterAICueBatcher>();
+
+    for (int32 i = 0; i < Agents.Num(); ++i)
+    {
+        AAIController* Controller = Agents[i].Controller.Get();
+        APawn* Pawn = Controller ? Controller->GetPawn() : nullptr;
+        if (!Pawn)
+        {
+            continue;
+        }
+
+        const FShooterAIDecisionInput& In = Inputs[i];
+        const FShooterAIDecisionOutput& Out = Outputs[i];
+
+        if (Out.bApplyFacing)
+        {
+            Pawn->SetActorRotation(Out.Facing);
+        }
+
+        UBlackboardComponent* BB = Controller->GetBlackboardComponent();
+        if (!BB || !EnumHasAnyFlags(In.Decisions, EShooterAIDecision::FlankOrRetreat))
+        {
+            continue;
+        }
+
+        // Blackboard writes and cues only on state transitions
+        if (Out.bRetreating != In.bWasRetreating)
+        {
+            BB->SetValueAsBool(ShooterAIDecisionKeys::IsRetreating, Out.bRetreating);
+            if (Out.bRetreating && CueBatcher)
+            {
+                CueBatcher->QueueCue(Pawn, ShooterTags::GameplayCue_Enemy_Retreat);
+            }
+        }
+
+        if (Out.bFlanking != In.bWasFlanking)
+        {
+            BB->SetValueAsBool(ShooterAIDecisionKeys::IsFlanking, Out.bFlanking);
+            if (Out.bFlanking && CueBatcher)
+            {
+                CueBatcher->QueueCue(Pawn, ShooterTags::GameplayCue_Enemy_Flank);
+            }
+        }
+    }
+}
+
+void UShooterAIDecisionSubsystem::OnCombatHealthChanged(const FShooterHealthEvent& Event)
+{
+    // Only registered agents have an entry; players and other characters are ignored
+    if (float* HealthFraction = HealthFractions.Find(Event.Character))
+    {
+        *HealthFraction = Event.GetNewFraction();
+    }
+}
+
+void UShooterAIDecisionSubsystem::OnCombatHealthDepleted(const FShooterHealthEvent& Event)
+{
+    // The entry stays while the agent is registered; a revive publishes full health again
+    if (float* HealthFraction = HealthFractions.Find(Event.Character))
+    {
+        *HealthFraction = 0.f;
+    }
+}
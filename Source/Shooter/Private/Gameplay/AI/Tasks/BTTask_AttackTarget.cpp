@@ -19,11 +19,18 @@ EBTNodeResult::Type UBTTask_AttackTarget::ExecuteTask(UBehaviorTreeComponent& Ow
         return EBTNodeResult::Failed;
     }
 
-    if (UAbilitySystemComponent* ASC = AIChar->GetAbilitySystemComponent())
+    if (!AIChar->GetAbilitySystemComponent())
     {
-        ASC->TryActivateAbilitiesByTag(FGameplayTagContainer(FGameplayTag::RequestGameplayTag(FName("Ability.Weapon.Fire"))));
-        return EBTNodeResult::Succeeded;
+        return EBTNodeResult::Failed;
+    }
+
+    // Activate by cached spec handle; the tag scan is only a fallback for a handle that was never granted
+    if (!AIChar->HasFireAbilityHandle())
+    {
+        static const FGameplayTagContainer FireTags(ShooterTags::Ability_Weapon_Fire);
+        return AIChar->GetAbilitySystemComponent()->TryActivateAbilitiesByTag(FireTags) ? EBTNodeResult::Succeeded : EBTNodeResult::Failed;
     }
 
-    return EBTNodeResult::Failed;
+    // Cooldown, blocked or cost failures
+    return AIChar->TryActivateFireAbility() ? EBTNodeResult::Succeeded : EBTNodeResult::Failed;
 }
@@ -1,5 +1,6 @@
 #include "Gameplay/Abilities/Abil_Dash.h"
 #include "Gameplay/Characters/Player/ShooterCharacter.h"
+#include "Gameplay/Characters/Player/Movement/ShooterCharacterMovement_Doom.h"
 
 #include "AbilitySystemComponent.h"
 #include "Engine/World.h"
@@ -85,6 +86,34 @@ void UAbil_Dash::OnAvatarSet(const FGameplayAbilityActorInfo* ActorInfo,
 {
     Super::OnAvatarSet(ActorInfo, Spec);
     UE_LOG(LogTemp, Warning, TEXT("Dash[Abil]: OnAvatarSet"));
+
+    // Runs wherever the ability is given (server and owning client), long before the first dash
+    ApplyDeprecatedTuning(ActorInfo);
+}
+
+void UAbil_Dash::ApplyDeprecatedTuning(const FGameplayAbilityActorInfo* ActorInfo) const
+{
+    const ACharacter* Char = ActorInfo ? Cast<ACharacter>(ActorInfo->AvatarActor.Get()) : nullptr;
+    UShooterCharacterMovement_Doom* Move = Char ? Cast<UShooterCharacterMovement_Doom>(Char->GetCharacterMovement()) : nullptr;
+    if (!Move)
+    {
+        return;
+    }
+
+    const bool bHasDeprecatedTuning = DashSpeed_DEPRECATED >= 0.f || DashDuration_DEPRECATED >= 0.f
+        || !bAllowAirDash_DEPRECATED || AirDashSpeedMultiplier_DEPRECATED >= 0.f;
+    if (!bHasDeprecatedTuning)
+    {
+        return;
+    }
+
+    if (DashSpeed_DEPRECATED >= 0.f) { Move->DashSpeed = DashSpeed_DEPRECATED; }
+    if (DashDuration_DEPRECATED >= 0.f) { Move->DashDuration = DashDuration_DEPRECATED; }
+    if (!bAllowAirDash_DEPRECATED) { Move->bAllowAirDash = false; }
+    if (AirDashSpeedMultiplier_DEPRECATED >= 0.f) { Move->AirDashSpeedMultiplier = AirDashSpeedMultiplier_DEPRECATED; }
+
+    UE_LOG(LogTemp, Warning, TEXT("Dash[Abil]: %s still carries dash tuning; copied to the movement component (move it there)"),
+        *GetClass()->GetName());
 }
 
 void UAbil_Dash::ActivateAbility(
@@ -100,7 +129,7 @@ void UAbil_Dash::ActivateAbility(
     ACharacter* Char = Cast<ACharacter>(ActorInfo->AvatarActor.Get());
     if (!Char) { EndAbility(Handle, ActorInfo, ActivationInfo, true, true); return; }
 
-    UCharacterMovementComponent* Move = Char->GetCharacterMovement();
+    UShooterCharacterMovement_Doom* Move = Cast<UShooterCharacterMovement_Doom>(Char->GetCharacterMovement());
     if (!Move) { EndAbility(Handle, ActorInfo, ActivationInfo, true, true); return; }
 
     AShooterCharacter* ShooterChar = Cast<AShooterCharacter>(Char);
@@ -136,65 +165,21 @@ void UAbil_Dash::ActivateAbility(
     DashesThisWindow = FMath::Clamp(DashesThisWindow + 1, 0, 2);
     UE_LOG(LogTemp, Warning, TEXT("Dash[Abil]: Activate: DashesThisWindow=%d (active=%d)"), DashesThisWindow, bDashActive ? 1 : 0);
 
-    // Direction
-    FVector Dir = FVector::ZeroVector;
-    if (!Move->GetCurrentAcceleration().IsNearlyZero(1.f))
-    {
-        Dir = Move->GetCurrentAcceleration().GetSafeNormal2D();
-        UE_LOG(LogTemp, Warning, TEXT("Dash[Abil]: Dir from Accel -> (%.2f, %.2f)"), Dir.X, Dir.Y);
-    }
-    else
-    {
-        FRotator ControlRot = FRotator::ZeroRotator;
-        if (AController* C = Char->GetController()) { ControlRot = C->GetControlRotation(); }
-        const FRotator YawOnly(0.f, ControlRot.Yaw, 0.f);
-        Dir = FRotationMatrix(YawOnly).GetUnitAxis(EAxis::X);
-        UE_LOG(LogTemp, Warning, TEXT("Dash[Abil]: Dir from ControlYaw -> (%.2f, %.2f)"), Dir.X, Dir.Y);
-    }
-    Dir.Z = 0.f; Dir = Dir.GetSafeNormal();
-
-    // Launch build
-    const bool bIsFalling = Move->IsFalling();
-    float Speed = DashSpeed;
-
-    if (bIsFalling && bAllowAirDash)
+    // The movement component dashes inside the predicted move: the owning client raises the
+    // saved-move flag and the server replays it from the move, so only the local side requests it.
+    // The server only honours that flag once the charge is consumed and the ability committed here.
+    if (ActorInfo->IsLocallyControlled())
     {
-        Speed *= AirDashSpeedMultiplier;
-
-        SavedFallingLateralFriction = Move->FallingLateralFriction;
-        SavedBrakingDecelFalling = Move->BrakingDecelerationFalling;
-        SavedAirControl = Move->AirControl;
-
-        Move->FallingLateralFriction = AirDashFallingLateralFriction;
-        Move->BrakingDecelerationFalling = AirDashBrakingDecel;
-        Move->AirControl = AirControlDuringAirDash;
+        Move->RequestDash();
     }
 
-    UE_LOG(LogTemp, Warning, TEXT("Dash[Abil]: %sDash: Speed=%.1f"),
-        bIsFalling ? TEXT("Air") : TEXT("Ground"), Speed);
-
-    const FVector DashXY = Dir * Speed;
-
-    float PreserveZ = Move->Velocity.Z;
-    if (bIsFalling) { PreserveZ = FMath::Min(PreserveZ, MaxUpwardVelDuringAirDash); }
-
-    UE_LOG(LogTemp, Warning, TEXT("Dash[Abil]: Pre-Launch Vel: (%.1f, %.1f, %.1f) Falling=%d PresZ=%.1f"),
-        Move->Velocity.X, Move->Velocity.Y, Move->Velocity.Z, bIsFalling ? 1 : 0, PreserveZ);
-
-    SavedBrakingFriction = Move->BrakingFrictionFactor;
-    if (!bIsFalling) { Move->BrakingFrictionFactor = 0.f; }
-
-    if (bIsFalling)
-    {
-        Char->LaunchCharacter(FVector(DashXY.X, DashXY.Y, 0.f), false, false);
-    }
-    else
+    if (ActorInfo->IsNetAuthority())
     {
-        Char->LaunchCharacter(FVector(DashXY.X, DashXY.Y, PreserveZ), true, false);
+        Move->AuthorizeServerDash();
     }
 
-    UE_LOG(LogTemp, Warning, TEXT("Dash[Abil]: Post-Launch Vel: (%.1f, %.1f, %.1f)"),
-        Move->Velocity.X, Move->Velocity.Y, Move->Velocity.Z);
+    UE_LOG(LogTemp, Warning, TEXT("Dash[Abil]: Requested %sdash (local=%d)"),
+        Move->IsFalling() ? TEXT("air ") : TEXT(""), ActorInfo->IsLocallyControlled() ? 1 : 0);
 
     // I-Frames
     if (GE_IFrames && ActorInfo->AbilitySystemComponent.IsValid())
@@ -227,11 +212,9 @@ void UAbil_Dash::ActivateAbility(
     {
         // If this is a chained dash, extend the "end" to the latest activation
         World->GetTimerManager().ClearTimer(EndTimer);
-        World->GetTimerManager().SetTimer(EndTimer, this, &UAbil_Dash::EndDash, DashDuration, false);
-        UE_LOG(LogTemp, Warning, TEXT("Dash[Abil]: EndTimer set: %.2fs (reset)"), DashDuration);
+        World->GetTimerManager().SetTimer(EndTimer, this, &UAbil_Dash::EndDash, Move->GetDashDuration(), false);
+        UE_LOG(LogTemp, Warning, TEXT("Dash[Abil]: EndTimer set: %.2fs (reset)"), Move->GetDashDuration());
     }
-
-    if (bUseCharges) { ShooterChar->EnsureDashRechargeRunning(); }
 }
 
 void UAbil_Dash::EndDash()
@@ -256,22 +239,12 @@ void UAbil_Dash::EndAbility(
     {
         if (ACharacter* Char = Cast<ACharacter>(ActorInfo->AvatarActor.Get()))
         {
+            // Back to aim-facing after the dash
             if (UCharacterMovementComponent* Move = Char->GetCharacterMovement())
             {
-                Move->FallingLateralFriction = SavedFallingLateralFriction >= 0.f ? SavedFallingLateralFriction : 0.f;
-                Move->BrakingDecelerationFalling = SavedBrakingDecelFalling >= 0.f ? SavedBrakingDecelFalling : 0.f;
-                Move->AirControl = SavedAirControl >= 0.f ? SavedAirControl : 0.6f;  // restore sensible default
-                Move->BrakingFrictionFactor = SavedBrakingFriction >= 0.f ? SavedBrakingFriction : 1.f;
-
                 Move->bOrientRotationToMovement = false;
-                Char->bUseControllerRotationYaw = true;
-
-                if (Move->MovementMode == MOVE_Falling)
-                {
-                    Move->FallingLateralFriction = 0.f;
-                    Move->BrakingDecelerationFalling = 0.f;
-                }
             }
+            Char->bUseControllerRotationYaw = true;
 
             if (UWorld* World = Char->GetWorld())
             {
@@ -285,10 +258,5 @@ void UAbil_Dash::EndAbility(
     DashesThisWindow = 0;
     UE_LOG(LogTemp, Warning, TEXT("Dash[Abil]: EndAbility: window closed"));
 
-    SavedBrakingFriction = -1.f;
-    SavedFallingLateralFriction = -1.f;
-    SavedBrakingDecelFalling = -1.f;
-    SavedAirControl = -1.f;
-
     Super::EndAbility(Handle, ActorInfo, ActivationInfo, bReplicateEndAbility, bWasCancelled);
 }
@@ -12,6 +12,8 @@
 
 #include "Gameplay/Characters/Player/ShooterCharacter.h"
 #include "Gameplay/Interaction/InteractableComponent.h"
+#include "Gameplay/Interaction/InteractableRegistrySubsystem.h"
+#include "Gameplay/Interaction/InteractionFocusComponent.h"
 #include "Gameplay/Tags/ShooterGameplayTags.h"
 #include "Gameplay/Tags/ShooterGameplayTags_Interact.h"
 
@@ -19,7 +21,6 @@ UAbil_Interact::UAbil_Interact()
 {
     InstancingPolicy = EGameplayAbilityInstancingPolicy::InstancedPerActor;
 
-    MaxInteractDistance = 250.0f;
     bDebugTrace = false;
 
     SetAssetTags(FGameplayTagContainer(ShooterTags::Ability_Utility_Interact));
@@ -37,26 +38,62 @@ bool UAbil_Interact::CanActivateAbility(
         return false;
     }
 
+    return FindInteractable(ActorInfo) != nullptr;
+}
+
+UInteractableComponent* UAbil_Interact::FindInteractable(const FGameplayAbilityActorInfo* ActorInfo) const
+{
     if (!ActorInfo || !ActorInfo->AvatarActor.IsValid())
     {
-        return false;
+        return nullptr;
     }
 
     AShooterCharacter* SC = Cast<AShooterCharacter>(ActorInfo->AvatarActor.Get());
-    if (!SC)
+    UInteractionFocusComponent* Focus = SC ? SC->GetInteractionFocus() : nullptr;
+    if (!Focus)
     {
-        return false;
+        return nullptr;
     }
 
-    FHitResult Hit;
-    AActor* HitActor = SC->PerformInteractionTrace(MaxInteractDistance, Hit);
-    if (!HitActor)
+    // Owning client: the cached async focus
+    if (Focus->IsLocalViewer())
     {
-        return false;
+        UInteractableComponent* Comp = Focus->GetFocusedInteractable();
+        if (!Comp || Focus->GetFocusDistance() > Focus->TraceDistance)
+        {
+            return nullptr;
+        }
+
+        return Comp->CanInteract(SC) ? Comp : nullptr;
     }
 
-    UInteractableComponent* Comp = HitActor->FindComponentByClass<UInteractableComponent>();
-    return Comp && Comp->CanInteract(SC);
+    // Server for remote players and bots: no trace, the registry picks the interactable nearest to a
+    // point half the reach along the view and checks it is within reach of the avatar
+    const UInteractableRegistrySubsystem* Registry = SC->GetWorld()->GetSubsystem<UInteractableRegistrySubsystem>();
+    if (!Registry)
+    {
+        return nullptr;
+    }
+
+    FVector ViewLocation;
+    FRotator ViewRotation;
+    SC->GetActorEyesViewPoint(ViewLocation, ViewRotation);
+
+    const float HalfReach = Focus->TraceDistance * 0.5f;
+    const FVector AimPoint = ViewLocation + ViewRotation.Vector() * HalfReach;
+
+    UInteractableComponent* Comp = Registry->FindNearestInteractable(AimPoint, HalfReach + Focus->MaxInteractableExtent, SC);
+    if (!Comp || !Registry->IsUsableBy(Comp, SC, Focus->TraceDistance + Focus->MaxInteractableExtent))
+    {
+        return nullptr;
+    }
+
+    if (bDebugTrace)
+    {
+        UE_LOG(LogTemp, Log, TEXT("Abil_Interact: %s resolved %s from the registry"), *SC->GetName(), *GetNameSafe(Comp->GetOwner()));
+    }
+
+    return Comp;
 }
 
 void UAbil_Interact::ActivateAbility(
@@ -80,34 +117,14 @@ void UAbil_Interact::ActivateAbility(
     }
 
     AShooterCharacter* SC = Cast<AShooterCharacter>(ActorInfo->AvatarActor.Get());
-    if (!SC)
-    {
-        EndAbility(Handle, ActorInfo, ActivationInfo, true, true);
-        return;
-    }
-
-    // Trace using the character
-    FHitResult Hit;
-    AActor* TargetActor = SC->PerformInteractionTrace(MaxInteractDistance, Hit);
-
-    if (!TargetActor)
-    {
-        EndAbility(Handle, ActorInfo, ActivationInfo, true, true);
-        return;
-    }
-
-    UInteractableComponent* Comp = TargetActor->FindComponentByClass<UInteractableComponent>();
-    if (!Comp)
+    UInteractableComponent* Comp = FindInteractable(ActorInfo);
+    if (!SC || !Comp)
     {
         EndAbility(Handle, ActorInfo, ActivationInfo, true, true);
         return;
     }
 
-    if (!Comp->CanInteract(SC))
-    {
-        EndAbility(Handle, ActorInfo, ActivationInfo, true, true);
-        return;
-    }
+    AActor* TargetActor = Comp->GetOwner();
 
     // Execute C++/BP event
     Comp->Interact(SC);
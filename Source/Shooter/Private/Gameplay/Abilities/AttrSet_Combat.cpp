@@ -1,5 +1,5 @@
 #include "Gameplay/Abilities/AttrSet_Combat.h"
-#include "Gameplay/Characters/ShooterCombatCharacter.h"
+#include "Gameplay/Net/ShooterPushModel.h"
 #include "Net/UnrealNetwork.h"
 #include "GameplayEffectExtension.h"
 
@@ -14,9 +14,36 @@ UAttrSet_Combat::UAttrSet_Combat()
 void UAttrSet_Combat::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
 {
 	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
-	DOREPLIFETIME_CONDITION_NOTIFY(UAttrSet_Combat, Health, COND_None, REPNOTIFY_Always);
-	DOREPLIFETIME_CONDITION_NOTIFY(UAttrSet_Combat, MaxHealth, COND_None, REPNOTIFY_Always);
-	DOREPLIFETIME_CONDITION_NOTIFY(UAttrSet_Combat, MoveSpeed, COND_None, REPNOTIFY_Always);
+
+	FDoRepLifetimeParams Params;
+	Params.bIsPushBased = true;
+	Params.RepNotifyCondition = REPNOTIFY_Always;
+	DOREPLIFETIME_WITH_PARAMS_FAST(UAttrSet_Combat, Health, Params);
+	DOREPLIFETIME_WITH_PARAMS_FAST(UAttrSet_Combat, MaxHealth, Params);
+	DOREPLIFETIME_WITH_PARAMS_FAST(UAttrSet_Combat, Stamina, Params);
+	DOREPLIFETIME_WITH_PARAMS_FAST(UAttrSet_Combat, MaxStamina, Params);
+	DOREPLIFETIME_WITH_PARAMS_FAST(UAttrSet_Combat, MoveSpeed, Params);
+}
+
+void UAttrSet_Combat::PostAttributeChange(const FGameplayAttribute& Attribute, float OldValue, float NewValue)
+{
+	Super::PostAttributeChange(Attribute, OldValue, NewValue);
+	MarkAttributeDirty(Attribute);
+}
+
+void UAttrSet_Combat::PostAttributeBaseChange(const FGameplayAttribute& Attribute, float OldValue, float NewValue) const
+{
+	Super::PostAttributeBaseChange(Attribute, OldValue, NewValue);
+	MarkAttributeDirty(Attribute);
+}
+
+void UAttrSet_Combat::MarkAttributeDirty(const FGameplayAttribute& Attribute) const
+{
+	if (const FProperty* Property = Attribute.GetUProperty())
+	{
+		MARK_PROPERTY_DIRTY(this, Property);
+		ShooterPushModel::RecordDirty(this, Property->GetFName());
+	}
 }
 
 void UAttrSet_Combat::OnRep_Health(const FGameplayAttributeData& OldValue) const
@@ -48,23 +75,11 @@ void UAttrSet_Combat::PostGameplayEffectExecute(const FGameplayEffectModCallback
 {
 	Super::PostGameplayEffectExecute(Data);
 
-	// Clamp health to [0, MaxHealth]
+	// Clamp health to [0, MaxHealth]; death and health events come from the ASC change delegate
+	// (AShooterCombatCharacter / UShooterCombatEventSubsystem)
 	if (Data.EvaluatedData.Attribute == GetHealthAttribute())
 	{
-		const float Clamped = FMath::Clamp(GetHealth(), 0.0f, GetMaxHealth());
-		SetHealth(Clamped);
-
-		if (Clamped <= 0.0f)
-		{
-			if (AShooterCombatCharacter* OwnerChar = Cast<AShooterCombatCharacter>(GetOwningActor()))
-			{
-				if (!OwnerChar->IsDead()) // prevent multiple death calls
-				{
-					UE_LOG(LogTemp, Warning, TEXT("%s has died."), *OwnerChar->GetName());
-					OwnerChar->OnOutOfHealth();
-				}
-			}
-		}
+		SetHealth(FMath::Clamp(GetHealth(), 0.0f, GetMaxHealth()));
 	}
 }
 
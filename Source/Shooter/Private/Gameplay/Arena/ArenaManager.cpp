@@ -1,38 +1,245 @@
 #include "Gameplay/Arena/ArenaManager.h"
+#include "Gameplay/Arena/ShooterEnemyPoolSubsystem.h"
+#include "Gameplay/Arena/ArenaWaveGenerator.h"
+#include "Gameplay/Arena/ShooterArenaCollisionSubsystem.h"
 #include "Gameplay/Characters/AI/ShooterAICharacter.h"
 #include "Gameplay/Characters/Player/ShooterCharacter.h"
 #include "Gameplay/Tags/ShooterGameplayTags.h"
 #include "Gameplay/Augments/AugmentPedestal.h"
 #include "Gameplay/Run/RunArenaData.h"
+#include "Gameplay/Run/RunDirector.h"
+#include "Gameplay/Run/ShooterRunHostSubsystem.h"
+#include "World/ShooterWorldRegistrySubsystem.h"
 
 #include "Kismet/GameplayStatics.h"
 #include "AbilitySystemBlueprintLibrary.h"
 #include "Engine/World.h"
-#include "EngineUtils.h"
+#include "TimerManager.h"
+
+// Summed over every draining arena; per-arena numbers are in AArenaManager::GetSpawnStats
+DECLARE_STATS_GROUP(TEXT("Arena"), STATGROUP_ShooterArena, STATCAT_Advanced);
+DECLARE_CYCLE_STAT(TEXT("Arena Spawn Queue"), STAT_ArenaSpawnQueue, STATGROUP_ShooterArena);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Spawn Queue Depth"), STAT_ArenaSpawnQueueDepth, STATGROUP_ShooterArena);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Spawns This Frame"), STAT_ArenaSpawnsThisFrame, STATGROUP_ShooterArena);
+DECLARE_FLOAT_COUNTER_STAT(TEXT("Spawn Cost This Frame (ms)"), STAT_ArenaSpawnCostMs, STATGROUP_ShooterArena);
+
+static TAutoConsoleVariable<float> CVarArenaSpawnBudgetMs(
+    TEXT("colosseum.Arena.SpawnBudgetMs"),
+    2.0f,
+    TEXT("Game-thread milliseconds per frame the arena spawn queue may spend (at least one spawn always runs)."),
+    ECVF_Cheat);
+
+static TAutoConsoleVariable<int32> CVarArenaMaxSpawnsPerFrame(
+    TEXT("colosseum.Arena.MaxSpawnsPerFrame"),
+    4,
+    TEXT("Hard cap on enemies spawned (or parked in the pool while prewarming) per frame by each arena."),
+    ECVF_Cheat);
+
+static TAutoConsoleVariable<int32> CVarArenaCrowdBatchSize(
+    TEXT("colosseum.Arena.CrowdBatchSize"),
+    16,
+    TEXT("Crowd entities added per spawn queue entry; each batch counts as one spawn against the budget."),
+    ECVF_Cheat);
+
+static FAutoConsoleCommandWithWorld CmdArenaSpawnStats(
+    TEXT("colosseum.Arena.SpawnStats"),
+    TEXT("Logs the spawn queue counters of every arena in the world."),
+    FConsoleCommandWithWorldDelegate::CreateLambda([](UWorld* World)
+    {
+        const UShooterWorldRegistrySubsystem* Registry = World ? World->GetSubsystem<UShooterWorldRegistrySubsystem>() : nullptr;
+        if (!Registry)
+        {
+            return;
+        }
+
+        TArray<AArenaManager*> Managers;
+        Registry->GetArenaManagers(Managers);
+        for (const AArenaManager* Manager : Managers)
+        {
+            const FArenaSpawnStats& Stats = Manager->GetSpawnStats();
+            UE_LOG(LogTemp, Log, TEXT("ArenaManager: %s queue %d | last frame %d spawns, %.2f ms (peak %.2f ms) | enemies %d, crowd %d, prewarmed %d"),
+                *Manager->GetName(), Stats.QueueDepth, Stats.SpawnsLastFrame, Stats.LastFrameCostMs, Stats.PeakFrameCostMs,
+                Stats.EnemiesSpawned, Stats.CrowdEntitiesSpawned, Stats.EnemiesPrewarmed);
+        }
+    }));
 
 AArenaManager::AArenaManager()
 {
-    PrimaryActorTick.bCanEverTick = false;
+    // Ticks only while a wave's spawn queue is draining
+    PrimaryActorTick.bCanEverTick = true;
+    PrimaryActorTick.bStartWithTickEnabled = false;
 }
 
 void AArenaManager::BeginPlay()
 {
     Super::BeginPlay();
 
-    PlayerRef = Cast<AShooterCharacter>(UGameplayStatics::GetPlayerPawn(GetWorld(), 0));
-    if (!PlayerRef)
+    // Hosted arenas get their player from the run host before StartArena
+    const UShooterRunHostSubsystem* Host = GetWorld()->GetSubsystem<UShooterRunHostSubsystem>();
+    if (!PlayerRef && !(Host && Host->IsHostingRuns()))
+    {
+        PlayerRef = Cast<AShooterCharacter>(UGameplayStatics::GetPlayerPawn(GetWorld(), 0));
+        if (!PlayerRef)
+        {
+            UE_LOG(LogTemp, Warning, TEXT("ArenaManager: Could not find player pawn at BeginPlay."));
+        }
+    }
+
+    if (UShooterWorldRegistrySubsystem* Registry = GetWorld()->GetSubsystem<UShooterWorldRegistrySubsystem>())
+    {
+        Registry->RegisterArenaManager(this);
+    }
+
+    if (UShooterArenaCollisionSubsystem* ArenaCollision = GetWorld()->GetSubsystem<UShooterArenaCollisionSubsystem>())
+    {
+        ArenaCollision->RegisterArenaProxies(this, ObjectPtrDecay(CombatCollisionProxies));
+    }
+
+    if (HasAuthority())
+    {
+        PrewarmEnemyPool();
+    }
+}
+
+void AArenaManager::PrewarmEnemyPool()
+{
+    UShooterEnemyPoolSubsystem* Pool = GetWorld()->GetSubsystem<UShooterEnemyPoolSubsystem>();
+    if (!Pool)
+    {
+        return;
+    }
+
+    // Peak simultaneous count per archetype across all waves; every crowd entity may end up promoted
+    TMap<TSubclassOf<AShooterAICharacter>, int32> PeakCounts;
+    for (const FArenaWaveData& Wave : Waves)
     {
-        UE_LOG(LogTemp, Warning, TEXT("ArenaManager: Could not find player pawn at BeginPlay."));
+        TMap<TSubclassOf<AShooterAICharacter>, int32> WaveCounts;
+        for (TSubclassOf<AShooterAICharacter> EnemyClass : Wave.EnemyClasses)
+        {
+            if (EnemyClass)
+            {
+                WaveCounts.FindOrAdd(EnemyClass)++;
+            }
+        }
+
+        for (const FArenaCrowdSpawn& CrowdSpawn : Wave.CrowdSpawns)
+        {
+            if (CrowdSpawn.PromotedClass)
+            {
+                WaveCounts.FindOrAdd(CrowdSpawn.PromotedClass) += CrowdSpawn.Count;
+            }
+        }
+
+        for (const TPair<TSubclassOf<AShooterAICharacter>, int32>& Pair : WaveCounts)
+        {
+            int32& Peak = PeakCounts.FindOrAdd(Pair.Key);
+            Peak = FMath::Max(Peak, Pair.Value);
+        }
+    }
+
+    // Spawning them all here would hitch arena start; ProcessSpawnQueue parks them under the spawn budget
+    PendingPrewarm.Reset();
+    for (const TPair<TSubclassOf<AShooterAICharacter>, int32>& Pair : PeakCounts)
+    {
+        const int32 ToPark = Pair.Value - Pool->GetNumInactive(Pair.Key);
+        for (int32 i = 0; i < ToPark; ++i)
+        {
+            PendingPrewarm.Add(Pair.Key);
+        }
+    }
+
+    if (PendingPrewarm.Num() > 0)
+    {
+        UE_LOG(LogTemp, Log, TEXT("ArenaManager: Queued %d pooled enemies to prewarm on %s"), PendingPrewarm.Num(), *GetName());
+        SetActorTickEnabled(true);
     }
 }
 
+void AArenaManager::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    GetWorldTimerManager().ClearTimer(SpawnTimerHandle);
+    PendingSpawns.Empty();
+    PendingPrewarm.Empty();
+    bSpawnQueueOpen = false;
+
+    // Streamed out mid-wave (hosted run restarted, player died): recycle the survivors
+    if (HasAuthority() && (EndPlayReason == EEndPlayReason::RemovedFromWorld || EndPlayReason == EEndPlayReason::Destroyed))
+    {
+        ReleaseActiveEnemies();
+    }
+
+    if (UShooterWorldRegistrySubsystem* Registry = GetWorld() ? GetWorld()->GetSubsystem<UShooterWorldRegistrySubsystem>() : nullptr)
+    {
+        Registry->UnregisterArenaManager(this);
+    }
+
+    if (UShooterArenaCollisionSubsystem* ArenaCollision = GetWorld() ? GetWorld()->GetSubsystem<UShooterArenaCollisionSubsystem>() : nullptr)
+    {
+        ArenaCollision->UnregisterArena(this);
+    }
+
+    if (UShooterCrowdSubsystem* Crowd = GetWorld() ? GetWorld()->GetSubsystem<UShooterCrowdSubsystem>() : nullptr)
+    {
+        Crowd->RemoveEntitiesOwnedBy(this);
+    }
+
+    Super::EndPlay(EndPlayReason);
+}
+
 void AArenaManager::SetCurrentArenaData(URunArenaData* InData)
 {
     CurrentArenaData = InData;
 }
 
+void AArenaManager::SetArenaPlayer(AShooterCharacter* InPlayer)
+{
+    PlayerRef = InPlayer;
+}
+
+void AArenaManager::SetRunContext(int32 Tier, int32 Seed)
+{
+    bHasRunContext = true;
+    RunContextTier = Tier;
+    RunContextSeed = Seed;
+}
+
+void AArenaManager::ReleaseActiveEnemies()
+{
+    UShooterEnemyPoolSubsystem* Pool = GetWorld() ? GetWorld()->GetSubsystem<UShooterEnemyPoolSubsystem>() : nullptr;
+
+    // Copy: releasing can re-enter OnEnemyDied through OnDied/OnDestroyed
+    const TArray<AShooterAICharacter*> Enemies = ActiveEnemies;
+    ActiveEnemies.Empty();
+
+    for (AShooterAICharacter* Enemy : Enemies)
+    {
+        if (!IsValid(Enemy))
+        {
+            continue;
+        }
+
+        Enemy->OnDied.RemoveDynamic(this, &AArenaManager::OnEnemyKilled);
+        Enemy->OnDestroyed.RemoveDynamic(this, &AArenaManager::OnEnemyDied);
+
+        if (Pool)
+        {
+            Pool->ReleaseEnemy(Enemy);
+        }
+        else
+        {
+            Enemy->Destroy();
+        }
+    }
+}
+
 void AArenaManager::StartArena()
 {
+    if (WaveGenerator && HasAuthority())
+    {
+        GenerateWaves();
+        PrewarmEnemyPool();
+    }
+
     if (Waves.Num() == 0)
     {
         UE_LOG(LogTemp, Warning, TEXT("ArenaManager: No waves configured on %s"), *GetName());
@@ -50,6 +257,38 @@ void AArenaManager::StartArena()
     );
 }
 
+void AArenaManager::GenerateWaves()
+{
+    URunDirector* RunDirector = GetGameInstance() ? GetGameInstance()->GetSubsystem<URunDirector>() : nullptr;
+
+    int32 Tier = CurrentArenaData ? CurrentArenaData->DifficultyTier : 1;
+    int32 Seed = FMath::Rand();
+
+    if (bHasRunContext)
+    {
+        Tier = RunContextTier;
+        Seed = RunContextSeed;
+    }
+    else if (RunDirector)
+    {
+        Tier = RunDirector->GetDifficultyTier();
+        Seed = RunDirector->GetArenaSeed();
+    }
+
+    // Draw from the run's seeded stream so a resumed run rebuilds the same waves
+    FRandomStream Random(Seed);
+
+    if (Waves.Num() == 0)
+    {
+        Waves.SetNum(WaveGenerator->WavesPerArena);
+    }
+
+    for (int32 i = 0; i < Waves.Num(); ++i)
+    {
+        WaveGenerator->GenerateWave(Tier, i, Random, Waves[i]);
+    }
+}
+
 void AArenaManager::SpawnWave(int32 WaveIndex)
 {
     if (!GetWorld())
@@ -65,39 +304,239 @@ void AArenaManager::SpawnWave(int32 WaveIndex)
     }
 
     ActiveEnemies.Empty();
+    PendingSpawns.Reset();
+    bSpawnQueueOpen = false;
+    GetWorldTimerManager().ClearTimer(SpawnTimerHandle);
 
     const FArenaWaveData& Wave = Waves[WaveIndex];
 
     for (TSubclassOf<AShooterAICharacter> EnemyClass : Wave.EnemyClasses)
     {
-        if (!EnemyClass)
+        if (EnemyClass)
         {
-            continue;
+            PendingSpawns.AddDefaulted_GetRef().EnemyClass = EnemyClass;
         }
+    }
+    const int32 EnemyCount = PendingSpawns.Num();
 
-        FActorSpawnParameters Params;
-        Params.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AdjustIfPossibleButAlwaysSpawn;
+    // Crowd entities share the queue, its SpawnDelay and its budget, in batches
+    const int32 CrowdBatchSize = FMath::Max(1, CVarArenaCrowdBatchSize.GetValueOnGameThread());
+    int32 CrowdCount = 0;
+    for (const FArenaCrowdSpawn& CrowdSpawn : Wave.CrowdSpawns)
+    {
+        for (int32 Queued = 0; Queued < CrowdSpawn.Count; Queued += CrowdBatchSize)
+        {
+            FArenaPendingSpawn& Batch = PendingSpawns.AddDefaulted_GetRef();
+            Batch.CrowdBatch = CrowdSpawn;
+            Batch.CrowdBatch.Count = FMath::Min(CrowdBatchSize, CrowdSpawn.Count - Queued);
+        }
+        CrowdCount += FMath::Max(0, CrowdSpawn.Count);
+    }
 
-        FVector SpawnLoc = GetActorLocation()
-            + FVector(FMath::RandRange(-400.f, 400.f), FMath::RandRange(-400.f, 400.f), 0.f);
-        FRotator SpawnRot = FRotator::ZeroRotator;
+    // Actors and crowd batches are spawned over the following frames; see ProcessSpawnQueue
+    if (PendingSpawns.Num() > 0)
+    {
+        if (Wave.SpawnDelay > 0.f)
+        {
+            GetWorldTimerManager().SetTimer(SpawnTimerHandle, this, &AArenaManager::BeginSpawnQueue, Wave.SpawnDelay, false);
+        }
+        else
+        {
+            BeginSpawnQueue();
+        }
+    }
 
-        AShooterAICharacter* Enemy = GetWorld()->SpawnActor<AShooterAICharacter>(
-            EnemyClass,
-            SpawnLoc,
-            SpawnRot,
-            Params
-        );
+    UE_LOG(LogTemp, Log, TEXT("ArenaManager: Queued wave %d on %s (EnemyCount=%d, CrowdCount=%d, SpawnDelay=%.2f)"),
+        WaveIndex, *GetName(), EnemyCount, CrowdCount, Wave.SpawnDelay);
+
+    // Nothing will die to clear an empty wave; clear it next frame, after the caller's arena events
+    if (IsWaveCleared())
+    {
+        UE_LOG(LogTemp, Warning, TEXT("ArenaManager: Wave %d on %s has nothing to spawn; treating it as cleared"), WaveIndex, *GetName());
+
+        GetWorldTimerManager().SetTimerForNextTick(FTimerDelegate::CreateWeakLambda(this, [this, WaveIndex]()
+        {
+            if (CurrentWaveIndex == WaveIndex && IsWaveCleared())
+            {
+                HandleWaveCleared();
+            }
+        }));
+    }
+}
+
+void AArenaManager::BeginSpawnQueue()
+{
+    bSpawnQueueOpen = true;
+    SetActorTickEnabled(true);
+}
+
+void AArenaManager::Tick(float DeltaSeconds)
+{
+    FShooterRunTickScope RunTickScope(this);
+
+    Super::Tick(DeltaSeconds);
+
+    ProcessSpawnQueue();
+}
+
+void AArenaManager::ProcessSpawnQueue()
+{
+    SCOPE_CYCLE_COUNTER(STAT_ArenaSpawnQueue);
+
+    UShooterEnemyPoolSubsystem* Pool = GetWorld()->GetSubsystem<UShooterEnemyPoolSubsystem>();
+    UShooterCrowdSubsystem* Crowd = GetWorld()->GetSubsystem<UShooterCrowdSubsystem>();
+
+    const double BudgetSeconds = CVarArenaSpawnBudgetMs.GetValueOnGameThread() / 1000.0;
+    const int32 MaxSpawns = FMath::Max(1, CVarArenaMaxSpawnsPerFrame.GetValueOnGameThread());
+    const double StartTime = FPlatformTime::Seconds();
+
+    int32 SpawnedThisFrame = 0;
+    int32 Consumed = 0;
+    int32 Parked = 0;
+
+    // Wave spawns first; prewarm gets whatever budget is left
+    const int32 NumSpawnable = bSpawnQueueOpen ? PendingSpawns.Num() : 0;
 
-        if (Enemy)
+    while ((Consumed < NumSpawnable || Parked < PendingPrewarm.Num()) && SpawnedThisFrame < MaxSpawns)
+    {
+        // Always make progress, then stop once the frame's budget is spent
+        if (SpawnedThisFrame > 0 && FPlatformTime::Seconds() - StartTime >= BudgetSeconds)
+        {
+            break;
+        }
+
+        if (Consumed < NumSpawnable)
+        {
+            const FArenaPendingSpawn& Entry = PendingSpawns[Consumed++];
+            if (Entry.EnemyClass)
+            {
+                AShooterAICharacter* Enemy = Pool ? Pool->AcquireEnemy(Entry.EnemyClass, GetNextSpawnTransform(), PlayerRef) : nullptr;
+                if (Enemy)
+                {
+                    TrackEnemy(Enemy);
+                    ++SpawnStats.EnemiesSpawned;
+                }
+                else
+                {
+                    UE_LOG(LogTemp, Warning, TEXT("ArenaManager: Failed to spawn %s on %s"), *GetNameSafe(Entry.EnemyClass), *GetName());
+                }
+            }
+            else if (Crowd)
+            {
+                SpawnStats.CrowdEntitiesSpawned += Crowd->SpawnCrowd(this, Entry.CrowdBatch, GetActorLocation(), CrowdSpawnRadius);
+            }
+        }
+        else
         {
-            ActiveEnemies.Add(Enemy);
-            Enemy->OnDestroyed.AddDynamic(this, &AArenaManager::OnEnemyDied);
+            // Park below the arena, out of sight
+            TSubclassOf<AShooterAICharacter> EnemyClass = PendingPrewarm[Parked++];
+            if (Pool && Pool->ParkNewEnemy(EnemyClass, GetActorLocation() - FVector(0.f, 0.f, 10000.f)))
+            {
+                ++SpawnStats.EnemiesPrewarmed;
+            }
         }
+
+        ++SpawnedThisFrame;
     }
 
-    UE_LOG(LogTemp, Log, TEXT("ArenaManager: Spawned wave %d on %s (EnemyCount=%d)"),
-        WaveIndex, *GetName(), ActiveEnemies.Num());
+    // Queue order is preserved so spawn points rotate predictably
+    PendingSpawns.RemoveAt(0, Consumed, EAllowShrinking::No);
+    PendingPrewarm.RemoveAt(0, Parked, EAllowShrinking::No);
+
+    const float FrameCostMs = (float)((FPlatformTime::Seconds() - StartTime) * 1000.0);
+    SpawnStats.QueueDepth = PendingSpawns.Num() + PendingPrewarm.Num();
+    SpawnStats.SpawnsLastFrame = SpawnedThisFrame;
+    SpawnStats.LastFrameCostMs = FrameCostMs;
+    SpawnStats.PeakFrameCostMs = FMath::Max(SpawnStats.PeakFrameCostMs, FrameCostMs);
+
+    INC_DWORD_STAT_BY(STAT_ArenaSpawnQueueDepth, SpawnStats.QueueDepth);
+    INC_DWORD_STAT_BY(STAT_ArenaSpawnsThisFrame, SpawnedThisFrame);
+    INC_FLOAT_STAT_BY(STAT_ArenaSpawnCostMs, FrameCostMs);
+
+    const bool bWaveSpawned = bSpawnQueueOpen && PendingSpawns.Num() == 0;
+    if (bWaveSpawned)
+    {
+        bSpawnQueueOpen = false;
+    }
+
+    // Waiting on SpawnDelay re-enables the tick through BeginSpawnQueue
+    if (PendingPrewarm.Num() == 0 && (!bSpawnQueueOpen || PendingSpawns.Num() == 0))
+    {
+        SetActorTickEnabled(false);
+    }
+
+    if (bWaveSpawned)
+    {
+        UE_LOG(LogTemp, Log, TEXT("ArenaManager: Finished spawning wave %d on %s (EnemyCount=%d)"),
+            CurrentWaveIndex, *GetName(), ActiveEnemies.Num());
+
+        // Every queued spawn may have failed
+        if (IsWaveCleared())
+        {
+            HandleWaveCleared();
+        }
+    }
+}
+
+FTransform AArenaManager::GetNextSpawnTransform()
+{
+    const int32 PointIndex = NextSpawnPointIndex++;
+
+    FVector Origin = GetActorLocation();
+    FRotator Rotation = FRotator::ZeroRotator;
+
+    const AActor* SpawnPoint = SpawnPoints.Num() > 0 ? SpawnPoints[PointIndex % SpawnPoints.Num()].Get() : nullptr;
+    if (SpawnPoint)
+    {
+        Origin = SpawnPoint->GetActorLocation();
+        Rotation = SpawnPoint->GetActorRotation();
+    }
+    else
+    {
+        // Fallback: golden-angle steps around a ring so consecutive spawns land far apart
+        const float Angle = PointIndex * 137.5f;
+        Origin += FRotator(0.f, Angle, 0.f).Vector() * SpawnRingRadius;
+        Rotation = (GetActorLocation() - Origin).GetSafeNormal2D().Rotation();
+    }
+
+    const FVector2D Jitter = FMath::RandPointInCircle(SpawnPointJitter);
+    return FTransform(Rotation, Origin + FVector(Jitter.X, Jitter.Y, 0.f));
+}
+
+void AArenaManager::RegisterPromotedEnemy(AShooterAICharacter* Enemy)
+{
+    TrackEnemy(Enemy);
+}
+
+void AArenaManager::TrackEnemy(AShooterAICharacter* Enemy)
+{
+    if (!Enemy)
+    {
+        return;
+    }
+
+    ActiveEnemies.AddUnique(Enemy);
+    Enemy->OnDied.AddUniqueDynamic(this, &AArenaManager::OnEnemyKilled);
+    Enemy->OnDestroyed.AddUniqueDynamic(this, &AArenaManager::OnEnemyDied);
+}
+
+void AArenaManager::OnCrowdEntitiesRemoved()
+{
+    if (IsWaveCleared())
+    {
+        HandleWaveCleared();
+    }
+}
+
+bool AArenaManager::IsWaveCleared() const
+{
+    if (ActiveEnemies.Num() > 0 || PendingSpawns.Num() > 0)
+    {
+        return false;
+    }
+
+    const UShooterCrowdSubsystem* Crowd = GetWorld() ? GetWorld()->GetSubsystem<UShooterCrowdSubsystem>() : nullptr;
+    return !Crowd || Crowd->GetNumEntitiesOwnedBy(this) == 0;
 }
 
 void AArenaManager::OnEnemyDied(AActor* DeadActor)
@@ -108,14 +547,26 @@ void AArenaManager::OnEnemyDied(AActor* DeadActor)
         return;
     }
 
-    ActiveEnemies.Remove(DeadEnemy);
+    DeadEnemy->OnDied.RemoveDynamic(this, &AArenaManager::OnEnemyKilled);
+    DeadEnemy->OnDestroyed.RemoveDynamic(this, &AArenaManager::OnEnemyDied);
+
+    // OnDied and OnDestroyed can both fire for the same enemy; only the first one counts
+    if (ActiveEnemies.Remove(DeadEnemy) == 0)
+    {
+        return;
+    }
 
-    if (ActiveEnemies.Num() == 0)
+    if (IsWaveCleared())
     {
         HandleWaveCleared();
     }
 }
 
+void AArenaManager::OnEnemyKilled(AShooterCombatCharacter* DeadCharacter)
+{
+    OnEnemyDied(DeadCharacter);
+}
+
 void AArenaManager::HandleWaveCleared()
 {
     // Broadcast Event.Arena.WaveCleared
@@ -227,10 +678,15 @@ void AArenaManager::HandleArenaVictory()
 
 void AArenaManager::OnAugmentChosen(AAugmentPedestal* PedestalChosen)
 {
-    // Destroy all pedestals
-    for (TActorIterator<AAugmentPedestal> It(GetWorld()); It; ++It)
+    // Destroy the pedestals this arena spawned
+    if (UShooterWorldRegistrySubsystem* Registry = GetWorld()->GetSubsystem<UShooterWorldRegistrySubsystem>())
     {
-        It->Destroy();
+        TArray<AAugmentPedestal*> Pedestals;
+        Registry->GetPedestalsOwnedBy(this, Pedestals);
+        for (AAugmentPedestal* Pedestal : Pedestals)
+        {
+            Pedestal->Destroy();
+        }
     }
 
     const bool bLastWave = (CurrentWaveIndex == Waves.Num() - 1);
@@ -271,6 +727,7 @@ void AArenaManager::SpawnArenaPedestals()
         FRotator SpawnRot = FRotator::ZeroRotator;
 
         FActorSpawnParameters Params;
+        Params.Owner = this;
         Params.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AdjustIfPossibleButAlwaysSpawn;
 
         AAugmentPedestal* Pedestal = World->SpawnActor<AAugmentPedestal>(
@@ -0,0 +1,109 @@
+#include "Gameplay/Arena/ArenaWaveGenerator.h"
+#include "Gameplay/Arena/ArenaManager.h"
+#include "Gameplay/Characters/AI/ShooterAICharacter.h"
+
+float UArenaWaveGeneratorData::GetThreatTarget(int32 DifficultyTier, int32 WaveIndex) const
+{
+    const float TierThreat = BaseThreat + ThreatPerTier * FMath::Max(0, DifficultyTier - 1);
+    return TierThreat * (1.f + ThreatGrowthPerWave * FMath::Max(0, WaveIndex));
+}
+
+float UArenaWaveGeneratorData::GenerateWave(int32 DifficultyTier, int32 WaveIndex, FRandomStream& Random, FArenaWaveData& OutWave) const
+{
+    OutWave.EnemyClasses.Reset();
+
+    const float TargetThreat = GetThreatTarget(DifficultyTier, WaveIndex);
+    float Threat = 0.f;
+    float ServerCost = 0.f;
+
+    TArray<int32> Counts;
+    Counts.SetNumZeroed(CostTable.Num());
+
+    TArray<int32> Candidates;
+    Candidates.Reserve(CostTable.Num());
+
+    while (Threat < TargetThreat)
+    {
+        const float RemainingThreat = TargetThreat - Threat;
+
+        // Affordable on both axes; allow overshooting the threat target by at most half an enemy
+        Candidates.Reset();
+        float TotalWeight = 0.f;
+        for (int32 i = 0; i < CostTable.Num(); ++i)
+        {
+            const FArenaEnemyCost& Entry = CostTable[i];
+            const bool bAllowed = Entry.EnemyClass
+                && Entry.Weight > 0.f
+                && Entry.ThreatCost > 0.f
+                && DifficultyTier >= Entry.MinTier
+                && (Entry.MaxPerWave == 0 || Counts[i] < Entry.MaxPerWave)
+                && Entry.ThreatCost * 0.5f <= RemainingThreat
+                && ServerCost + Entry.ServerCostMs <= ServerBudgetMs;
+
+            if (bAllowed)
+            {
+                Candidates.Add(i);
+                TotalWeight += Entry.Weight;
+            }
+        }
+
+        if (Candidates.Num() == 0)
+        {
+            break;
+        }
+
+        float Roll = Random.FRandRange(0.f, TotalWeight);
+        int32 Picked = Candidates.Last();
+        for (int32 Index : Candidates)
+        {
+            Roll -= CostTable[Index].Weight;
+            if (Roll <= 0.f)
+            {
+                Picked = Index;
+                break;
+            }
+        }
+
+        const FArenaEnemyCost& Entry = CostTable[Picked];
+        OutWave.EnemyClasses.Add(Entry.EnemyClass);
+        Threat += Entry.ThreatCost;
+        ServerCost += Entry.ServerCostMs;
+        ++Counts[Picked];
+    }
+
+    // A wave is never empty: fall back to the cheapest archetype of the tier, even over budget
+    if (OutWave.EnemyClasses.Num() == 0)
+    {
+        const FArenaEnemyCost* Cheapest = nullptr;
+        for (const FArenaEnemyCost& Entry : CostTable)
+        {
+            if (Entry.EnemyClass && Entry.ThreatCost > 0.f && DifficultyTier >= Entry.MinTier
+                && (!Cheapest || Entry.ThreatCost < Cheapest->ThreatCost))
+            {
+                Cheapest = &Entry;
+            }
+        }
+
+        if (Cheapest)
+        {
+            OutWave.EnemyClasses.Add(Cheapest->EnemyClass);
+            Threat += Cheapest->ThreatCost;
+            ServerCost += Cheapest->ServerCostMs;
+        }
+        else
+        {
+            UE_LOG(LogTemp, Error, TEXT("ArenaWaveGenerator: No cost table entry is usable at tier %d; wave %d is empty"), DifficultyTier, WaveIndex);
+        }
+    }
+
+    if (Threat < TargetThreat * 0.9f)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("ArenaWaveGenerator: Wave %d (Tier %d) capped at threat %.1f / %.1f by the %.2f ms server budget or cost table"),
+            WaveIndex, DifficultyTier, Threat, TargetThreat, ServerBudgetMs);
+    }
+
+    UE_LOG(LogTemp, Log, TEXT("ArenaWaveGenerator: Wave %d (Tier %d): %d enemies, threat %.1f / %.1f, server cost %.2f / %.2f ms"),
+        WaveIndex, DifficultyTier, OutWave.EnemyClasses.Num(), Threat, TargetThreat, ServerCost, ServerBudgetMs);
+
+    return Threat;
+}
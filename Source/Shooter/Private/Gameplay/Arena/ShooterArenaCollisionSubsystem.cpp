@@ -0,0 +1,135 @@
+#include "Gameplay/Arena/ShooterArenaCollisionSubsystem.h"
+#include "Gameplay/Characters/ShooterCombatCharacter.h"
+#include "Gameplay/Combat/ShooterCollisionChannels.h"
+
+#include "Components/CapsuleComponent.h"
+#include "Components/PrimitiveComponent.h"
+#include "Components/SkeletalMeshComponent.h"
+
+static TAutoConsoleVariable<bool> CVarArenaScopedTraces(
+    TEXT("colosseum.Collision.ArenaScopedTraces"),
+    true,
+    TEXT("Route combat traces that start inside an arena with registered collision proxies through the ArenaCombat channel."),
+    ECVF_Cheat);
+
+static TAutoConsoleVariable<float> CVarArenaBoundsPadding(
+    TEXT("colosseum.Collision.ArenaBoundsPadding"),
+    200.f,
+    TEXT("Padding added around an arena's collision proxy bounds when deciding whether a trace starts inside it."),
+    ECVF_Cheat);
+
+void UShooterArenaCollisionSubsystem::Deinitialize()
+{
+    ArenaProxies.Empty();
+
+    Super::Deinitialize();
+}
+
+void UShooterArenaCollisionSubsystem::SetCombatResponse(UPrimitiveComponent* Primitive, bool bBlock)
+{
+    if (Primitive)
+    {
+        Primitive->SetCollisionResponseToChannel(ShooterCollision::ArenaCombat, bBlock ? ECR_Block : ECR_Ignore);
+    }
+}
+
+void UShooterArenaCollisionSubsystem::RegisterArenaProxies(const AActor* Arena, const TArray<AActor*>& ProxyActors)
+{
+    if (!Arena)
+    {
+        return;
+    }
+
+    FArenaProxySet& Set = ArenaProxies.FindOrAdd(Arena);
+    TArray<TWeakObjectPtr<UPrimitiveComponent>>& Registered = Set.Primitives;
+
+    TArray<UPrimitiveComponent*> Primitives;
+    for (const AActor* Proxy : ProxyActors)
+    {
+        if (!Proxy)
+        {
+            continue;
+        }
+
+        Proxy->GetComponents(Primitives);
+        for (UPrimitiveComponent* Primitive : Primitives)
+        {
+            if (Primitive->IsCollisionEnabled())
+            {
+                SetCombatResponse(Primitive, true);
+                Registered.AddUnique(Primitive);
+            }
+        }
+    }
+
+    UE_LOG(LogTemp, Log, TEXT("ShooterArenaCollisionSubsystem: %s registered %d combat collision primitives"),
+        *Arena->GetName(), Registered.Num());
+
+    // An arena without proxies would make every combat trace miss the level
+    if (Registered.Num() == 0)
+    {
+        ArenaProxies.Remove(Arena);
+        return;
+    }
+
+    Set.Bounds = FBox(ForceInit);
+    for (const TWeakObjectPtr<UPrimitiveComponent>& Primitive : Registered)
+    {
+        if (Primitive.IsValid())
+        {
+            Set.Bounds += Primitive->Bounds.GetBox();
+        }
+    }
+    Set.Bounds = Set.Bounds.ExpandBy(CVarArenaBoundsPadding.GetValueOnGameThread());
+}
+
+void UShooterArenaCollisionSubsystem::UnregisterArena(const AActor* Arena)
+{
+    FArenaProxySet Registered;
+    if (!ArenaProxies.RemoveAndCopyValue(Arena, Registered))
+    {
+        return;
+    }
+
+    for (const TWeakObjectPtr<UPrimitiveComponent>& Primitive : Registered.Primitives)
+    {
+        SetCombatResponse(Primitive.Get(), false);
+    }
+}
+
+void UShooterArenaCollisionSubsystem::RegisterCombatant(AShooterCombatCharacter* Character)
+{
+    if (Character)
+    {
+        SetCombatResponse(Character->GetCapsuleComponent(), true);
+        SetCombatResponse(Character->GetMesh(), true);
+    }
+}
+
+void UShooterArenaCollisionSubsystem::UnregisterCombatant(AShooterCombatCharacter* Character)
+{
+    if (Character)
+    {
+        SetCombatResponse(Character->GetCapsuleComponent(), false);
+        SetCombatResponse(Character->GetMesh(), false);
+    }
+}
+
+ECollisionChannel UShooterArenaCollisionSubsystem::GetCombatTraceChannel(const FVector& TraceStart, ECollisionChannel Fallback) const
+{
+    if (!CVarArenaScopedTraces.GetValueOnGameThread())
+    {
+        return Fallback;
+    }
+
+    // Only the arena the trace starts in has its geometry on the combat channel
+    for (const TPair<TObjectKey<AActor>, FArenaProxySet>& Pair : ArenaProxies)
+    {
+        if (Pair.Value.Bounds.IsInsideOrOn(TraceStart))
+        {
+            return ShooterCollision::ArenaCombat;
+        }
+    }
+
+    return Fallback;
+}
@@ -0,0 +1,120 @@
+#include "Gameplay/Arena/ShooterEnemyPoolSubsystem.h"
+#include "Gameplay/Characters/AI/ShooterAICharacter.h"
+
+#include "Engine/World.h"
+
+void UShooterEnemyPoolSubsystem::Deinitialize()
+{
+    Buckets.Empty();
+
+    Super::Deinitialize();
+}
+
+AShooterAICharacter* UShooterEnemyPoolSubsystem::SpawnPooledEnemy(TSubclassOf<AShooterAICharacter> EnemyClass, const FTransform& SpawnTransform, AActor* CombatTarget)
+{
+    UWorld* World = GetWorld();
+    if (!World || !EnemyClass)
+    {
+        return nullptr;
+    }
+
+    // Deferred so the target is known before the controller starts its combat logic
+    AShooterAICharacter* Enemy = World->SpawnActorDeferred<AShooterAICharacter>(
+        EnemyClass, SpawnTransform, nullptr, nullptr, ESpawnActorCollisionHandlingMethod::AdjustIfPossibleButAlwaysSpawn);
+    if (!Enemy)
+    {
+        return nullptr;
+    }
+
+    Enemy->bPoolManaged = true;
+    Enemy->CombatTarget = CombatTarget;
+    Enemy->FinishSpawning(SpawnTransform);
+
+    return Enemy;
+}
+
+void UShooterEnemyPoolSubsystem::PrewarmArchetype(TSubclassOf<AShooterAICharacter> EnemyClass, int32 Count, const FVector& ParkLocation)
+{
+    UWorld* World = GetWorld();
+    if (!EnemyClass || !World || World->GetNetMode() == NM_Client)
+    {
+        return;
+    }
+
+    const int32 ToSpawn = Count - GetNumInactive(EnemyClass);
+    for (int32 i = 0; i < ToSpawn; ++i)
+    {
+        ParkNewEnemy(EnemyClass, ParkLocation);
+    }
+
+    UE_LOG(LogTemp, Log, TEXT("ShooterEnemyPoolSubsystem: Prewarmed %s (Inactive=%d)"),
+        *GetNameSafe(EnemyClass), GetNumInactive(EnemyClass));
+}
+
+bool UShooterEnemyPoolSubsystem::ParkNewEnemy(TSubclassOf<AShooterAICharacter> EnemyClass, const FVector& ParkLocation)
+{
+    UWorld* World = GetWorld();
+    if (!EnemyClass || !World || World->GetNetMode() == NM_Client)
+    {
+        return false;
+    }
+
+    AShooterAICharacter* Enemy = SpawnPooledEnemy(EnemyClass, FTransform(ParkLocation));
+    if (!Enemy)
+    {
+        return false;
+    }
+
+    Enemy->DeactivateForPool();
+    Buckets.FindOrAdd(EnemyClass).Inactive.Add(Enemy);
+    return true;
+}
+
+AShooterAICharacter* UShooterEnemyPoolSubsystem::AcquireEnemy(TSubclassOf<AShooterAICharacter> EnemyClass, const FTransform& SpawnTransform, AActor* CombatTarget)
+{
+    UWorld* World = GetWorld();
+    if (!EnemyClass || !World || World->GetNetMode() == NM_Client)
+    {
+        return nullptr;
+    }
+
+    if (FShooterEnemyPoolBucket* Bucket = Buckets.Find(EnemyClass))
+    {
+        while (Bucket->Inactive.Num() > 0)
+        {
+            AShooterAICharacter* Enemy = Bucket->Inactive.Pop(EAllowShrinking::No);
+            if (IsValid(Enemy))
+            {
+                Enemy->CombatTarget = CombatTarget;
+                Enemy->ActivateFromPool(SpawnTransform);
+                return Enemy;
+            }
+        }
+    }
+
+    // Pool ran dry (or was never prewarmed): grow it
+    return SpawnPooledEnemy(EnemyClass, SpawnTransform, CombatTarget);
+}
+
+void UShooterEnemyPoolSubsystem::ReleaseEnemy(AShooterAICharacter* Enemy)
+{
+    if (!IsValid(Enemy) || Enemy->IsInPool())
+    {
+        return;
+    }
+
+    if (!Enemy->bPoolManaged)
+    {
+        Enemy->Destroy();
+        return;
+    }
+
+    Enemy->DeactivateForPool();
+    Buckets.FindOrAdd(Enemy->GetClass()).Inactive.Add(Enemy);
+}
+
+int32 UShooterEnemyPoolSubsystem::GetNumInactive(TSubclassOf<AShooterAICharacter> EnemyClass) const
+{
+    const FShooterEnemyPoolBucket* Bucket = Buckets.Find(EnemyClass);
+    return Bucket ? Bucket->Inactive.Num() : 0;
+}
@@ -3,6 +3,7 @@
 
 #include "Gameplay/Augments/AugmentManagerComponent.h"
 #include "Gameplay/Characters/Player/ShooterCharacter.h"
+#include "Gameplay/Net/ShooterPushModel.h"
 
 #include "AbilitySystemBlueprintLibrary.h"
 #include "AbilitySystemComponent.h"
@@ -31,6 +32,7 @@ void UAugmentManagerComponent::ApplyAugment(const FAugmentData& Data)
 
     ApplyGEToSelf(Data.GameplayEffectClass);
     AppliedAugments.Add(Data);
+    SHOOTER_MARK_DIRTY(UAugmentManagerComponent, AppliedAugments, this);
 
     // Replicate to clients
     if (GetOwnerRole() == ROLE_Authority)
@@ -53,6 +55,18 @@ void UAugmentManagerComponent::ApplyGEToSelf(TSubclassOf<UGameplayEffect> GEClas
     }
 }
 
+void UAugmentManagerComponent::ClearAugments()
+{
+    if (GetOwnerRole() != ROLE_Authority)
+    {
+        return;
+    }
+
+    AppliedAugments.Reset();
+    SHOOTER_MARK_DIRTY(UAugmentManagerComponent, AppliedAugments, this);
+    OnRep_AppliedAugments();
+}
+
 void UAugmentManagerComponent::OnRep_AppliedAugments()
 {
     // Optionally update UI or effects when replicated
@@ -61,6 +75,9 @@ void UAugmentManagerComponent::OnRep_AppliedAugments()
 void UAugmentManagerComponent::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
 {
     Super::GetLifetimeReplicatedProps(OutLifetimeProps);
-    DOREPLIFETIME(UAugmentManagerComponent, AppliedAugments);
+
+    FDoRepLifetimeParams Params;
+    Params.bIsPushBased = true;
+    DOREPLIFETIME_WITH_PARAMS_FAST(UAugmentManagerComponent, AppliedAugments, Params);
 }
 
@@ -6,6 +6,7 @@
 #include "Gameplay/Interaction/InteractableComponent.h"
 #include "Gameplay/Augments/AugmentManagerComponent.h"
 #include "Gameplay/Characters/Player/ShooterCharacter.h"
+#include "World/ShooterWorldRegistrySubsystem.h"
 
 #include "Components/StaticMeshComponent.h"
 #include "Components/SphereComponent.h"
@@ -16,6 +17,9 @@ AAugmentPedestal::AAugmentPedestal()
     PrimaryActorTick.bCanEverTick = false;
     bReplicates = true;
 
+    // Nothing changes until someone picks it; woken in HandleInteract
+    NetDormancy = DORM_DormantAll;
+
     PedestalMesh = CreateDefaultSubobject<UStaticMeshComponent>("PedestalMesh");
     SetRootComponent(PedestalMesh);
 
@@ -37,6 +41,21 @@ AAugmentPedestal::AAugmentPedestal()
 void AAugmentPedestal::BeginPlay()
 {
     Super::BeginPlay();
+
+    if (UShooterWorldRegistrySubsystem* Registry = GetWorld()->GetSubsystem<UShooterWorldRegistrySubsystem>())
+    {
+        Registry->RegisterPedestal(this);
+    }
+}
+
+void AAugmentPedestal::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    if (UShooterWorldRegistrySubsystem* Registry = GetWorld() ? GetWorld()->GetSubsystem<UShooterWorldRegistrySubsystem>() : nullptr)
+    {
+        Registry->UnregisterPedestal(this);
+    }
+
+    Super::EndPlay(EndPlayReason);
 }
 
 void AAugmentPedestal::HandleInteract(AActor* InteractingActor)
@@ -67,11 +86,15 @@ void AAugmentPedestal::HandleInteract(AActor* InteractingActor)
 
         bSelected = true;
 
-        // Notify arena manager
-        OnAugmentChosen.Broadcast(this);
+        // Wake and send before notifying: the arena manager destroys its pedestals in the
+        // broadcast, and dormant actors drop multicasts
+        SetNetDormancy(DORM_Awake);
 
         // Hide and disable for all clients
         Multicast_OnAugmentChosen();
+
+        // Notify arena manager
+        OnAugmentChosen.Broadcast(this);
     }
 }
 
@@ -3,7 +3,12 @@
 
 #include "Gameplay/Characters/AI/ShooterAICharacter.h"
 #include "Gameplay/AI/Controller/ShooterAIController.h"
+#include "Gameplay/AI/ShooterAICombatDirector.h"
+#include "Gameplay/Arena/ShooterEnemyPoolSubsystem.h"
+#include "Gameplay/Combat/Weapons/Base/ShooterWeaponBase.h"
 #include "GameFramework/CharacterMovementComponent.h"
+#include "Kismet/GameplayStatics.h"
+#include "AbilitySystemComponent.h"
 
 AShooterAICharacter::AShooterAICharacter()
 {
@@ -26,4 +31,144 @@ void AShooterAICharacter::BeginPlay()
         // Optional: confirm controller is using ShooterAIController
         UE_LOG(LogTemp, Log, TEXT("%s AI spawned with controller: %s"), *GetName(), *GetNameSafe(AIC));
     }
+
+    // Attacks are scheduled server-side by the combat director
+    if (HasAuthority())
+    {
+        SetCombatParticipation(true);
+    }
+}
+
+void AShooterAICharacter::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    SetCombatParticipation(false);
+
+    Super::EndPlay(EndPlayReason);
+}
+
+void AShooterAICharacter::SetCombatParticipation(bool bActive)
+{
+    UWorld* World = GetWorld();
+    UShooterAICombatDirector* Director = World ? World->GetSubsystem<UShooterAICombatDirector>() : nullptr;
+    if (!Director)
+    {
+        return;
+    }
+
+    if (bActive)
+    {
+        Director->RegisterAttacker(this);
+    }
+    else
+    {
+        Director->UnregisterAttacker(this);
+    }
+}
+
+void AShooterAICharacter::SetCombatTarget(AActor* InTarget)
+{
+    CombatTarget = InTarget;
+
+    if (AShooterAIController* AIC = Cast<AShooterAIController>(GetController()))
+    {
+        AIC->SetCombatTarget(InTarget);
+    }
+}
+
+AActor* AShooterAICharacter::GetCombatTarget() const
+{
+    if (AActor* Target = CombatTarget.Get())
+    {
+        return Target;
+    }
+
+    return UGameplayStatics::GetPlayerPawn(this, 0);
+}
+
+void AShooterAICharacter::OnCorpseExpired()
+{
+    UShooterEnemyPoolSubsystem* Pool = GetWorld()->GetSubsystem<UShooterEnemyPoolSubsystem>();
+    if (bPoolManaged && Pool)
+    {
+        Pool->ReleaseEnemy(this);
+        return;
+    }
+
+    Super::OnCorpseExpired();
+}
+
+void AShooterAICharacter::DeactivateForPool()
+{
+    bInPool = true;
+
+    // Drop the ragdoll now so parked corpses stop simulating
+    ResetDeathState();
+    SetCombatParticipation(false);
+    GetWorldTimerManager().ClearAllTimersForObject(this);
+
+    if (AShooterAIController* AIC = Cast<AShooterAIController>(GetController()))
+    {
+        AIC->PauseForPool();
+    }
+
+    if (UCharacterMovementComponent* Move = GetCharacterMovement())
+    {
+        Move->StopMovementImmediately();
+        Move->DisableMovement();
+        Move->SetComponentTickEnabled(false);
+    }
+
+    if (ASC)
+    {
+        ASC->CancelAllAbilities();
+    }
+
+    // Weapon timers (auto/burst) would keep firing from the parked actor
+    if (AShooterWeaponBase* Weapon = GetEquippedWeapon())
+    {
+        Weapon->ResetWeaponState();
+    }
+
+    TArray<AActor*> Attached;
+    GetAttachedActors(Attached);
+    for (AActor* Child : Attached)
+    {
+        Child->SetActorHiddenInGame(true);
+    }
+
+    SetActorHiddenInGame(true);
+    SetActorEnableCollision(false);
+    SetActorTickEnabled(false);
+}
+
+void AShooterAICharacter::ActivateFromPool(const FTransform& SpawnTransform)
+{
+    ResetCombatState();
+
+    SetActorLocationAndRotation(SpawnTransform.GetLocation(), SpawnTransform.GetRotation(), false, nullptr, ETeleportType::ResetPhysics);
+
+    SetActorHiddenInGame(false);
+    SetActorEnableCollision(true);
+    SetActorTickEnabled(true);
+
+    TArray<AActor*> Attached;
+    GetAttachedActors(Attached);
+    for (AActor* Child : Attached)
+    {
+        Child->SetActorHiddenInGame(false);
+    }
+
+    if (UCharacterMovementComponent* Move = GetCharacterMovement())
+    {
+        Move->SetComponentTickEnabled(true);
+        Move->SetMovementMode(MOVE_Walking);
+    }
+
+    if (AShooterAIController* AIC = Cast<AShooterAIController>(GetController()))
+    {
+        AIC->RestartCombatLogic();
+    }
+
+    bInPool = false;
+    SetCombatParticipation(true);
 }
@@ -7,8 +7,6 @@
 
 #include "AbilitySystemComponent.h"
 #include "AbilitySystemGlobals.h"
-#include "Kismet/GameplayStatics.h"
-#include "TimerManager.h"
 
 AShooterAI_Charger::AShooterAI_Charger()
 {
@@ -16,18 +14,15 @@ AShooterAI_Charger::AShooterAI_Charger()
     ArchetypeTag = ShooterTags::Enemy_Type_Charger;
 }
 
-void AShooterAI_Charger::BeginPlay()
+bool AShooterAI_Charger::PerformScheduledAttack(const AActor* Target)
 {
-    Super::BeginPlay();
+    if (bIsDead || !ASC || !Target) return false;
 
-    // Start repeating melee checks
-    GetWorldTimerManager().SetTimer(AttackTimerHandle, this, &AShooterAI_Charger::PerformMeleeAttack, AttackInterval, true);
-}
-
-void AShooterAI_Charger::PerformMeleeAttack()
-{
-    if (bIsDead || !ASC) return;
+    // Only slam when the player is actually within reach
+    if (FVector::DistSquared(GetActorLocation(), Target->GetActorLocation()) > FMath::Square(AttackRange))
+    {
+        return false;
+    }
 
-    FGameplayTagContainer MeleeTags(ShooterTags::Ability_Weapon_Fire);
-    ASC->TryActivateAbilitiesByTag(MeleeTags);
+    return TryActivateMeleeAbility();
 }
@@ -2,7 +2,6 @@
 
 
 #include "Gameplay/Characters/AI/ShooterAI_Marksman.h"
-#include "Kismet/GameplayStatics.h"
 #include "Gameplay/Tags/ShooterGameplayTags.h"
 #include "AbilitySystemComponent.h"
 #include "Gameplay/Combat/Weapons/Base/ShooterWeaponBase.h"
@@ -20,22 +19,17 @@ void AShooterAI_Marksman::BeginPlay()
     {
         SpawnDefaultWeapon_Internal();
     }
-
-    GetWorldTimerManager().SetTimer(FireTimerHandle, this, &AShooterAI_Marksman::TryRangedAttack, FireInterval, true);
 }
 
-void AShooterAI_Marksman::TryRangedAttack()
+bool AShooterAI_Marksman::PerformScheduledAttack(const AActor* Target)
 {
-    if (bIsDead || !ASC) return;
-
-    APawn* PlayerPawn = UGameplayStatics::GetPlayerPawn(GetWorld(), 0);
-    if (!PlayerPawn) return;
+    if (bIsDead || !ASC || !Target) return false;
 
-    const float Dist = FVector::Dist(GetActorLocation(), PlayerPawn->GetActorLocation());
-    if (Dist > MinEngageDistance)
+    const float DistSq = FVector::DistSquared(GetActorLocation(), Target->GetActorLocation());
+    if (DistSq <= FMath::Square(MinEngageDistance))
     {
-        // Use the same gameplay tag system as the player
-        FGameplayTagContainer FireTags(ShooterTags::Ability_Weapon_Fire);
-        ASC->TryActivateAbilitiesByTag(FireTags);
+        return false;
     }
+
+    return TryActivateFireAbility();
 }
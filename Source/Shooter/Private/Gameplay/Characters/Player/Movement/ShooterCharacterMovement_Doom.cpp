@@ -3,7 +3,26 @@
 
 // ShooterCharacterMovement_Doom.cpp
 #include "Gameplay/Characters/Player/Movement/ShooterCharacterMovement_Doom.h"
+#include "Gameplay/Characters/Player/Movement/ShooterMovementTelemetrySubsystem.h"
+#include "Gameplay/Run/ShooterRunHostSubsystem.h"
 #include "GameFramework/Character.h"
+#include "GameFramework/GameModeBase.h"
+#include "GameFramework/PlayerController.h"
+#include "Engine/World.h"
+
+// Must match on server and clients, otherwise every apex becomes a correction
+static TAutoConsoleVariable<int32> CVarApexMomentumRestore(
+	TEXT("colosseum.Movement.ApexMomentumRestore"),
+	1,
+	TEXT("Restore lost horizontal momentum while falling (A/B against colosseum.Movement.TelemetryReport)."),
+	ECVF_Cheat);
+
+// Covers the gap between the ability's server activation and the move that carries the dash flag
+static TAutoConsoleVariable<float> CVarDashAuthorizationWindow(
+	TEXT("colosseum.Movement.DashAuthorizationWindow"),
+	0.5f,
+	TEXT("Seconds a server-side dash authorization stays valid for the owning client's next dash flag."),
+	ECVF_Cheat);
 
 UShooterCharacterMovement_Doom::UShooterCharacterMovement_Doom()
 {
@@ -40,6 +59,11 @@ UShooterCharacterMovement_Doom::UShooterCharacterMovement_Doom()
 
 float UShooterCharacterMovement_Doom::GetMaxSpeed() const
 {
+	if (IsDashing())
+	{
+		return DashSpeed;
+	}
+
 	// Use SKG sprint flag system
 	if (MovementMode == MOVE_Walking || MovementMode == MOVE_NavWalking)
 	{
@@ -82,11 +106,338 @@ void UShooterCharacterMovement_Doom::PhysFalling(float DeltaTime, int32 Iteratio
 	const FVector HorizPrev = FVector(PrevVel.X, PrevVel.Y, 0.f);
 	const FVector HorizNow = FVector(Velocity.X, Velocity.Y, 0.f);
 
-	// Restore lost horizontal momentum at jump apex
-	if (HorizNow.SizeSquared() < HorizPrev.SizeSquared() * 0.8f)
+	// Restore lost horizontal momentum at jump apex. Depends only on the move's own velocities,
+	// so it replays identically on the client; the correction telemetry tracks it under Falling.
+	if (CVarApexMomentumRestore.GetValueOnGameThread() != 0 && HorizNow.SizeSquared() < HorizPrev.SizeSquared() * 0.8f)
 	{
 		const FVector Restored = FMath::Lerp(HorizNow, HorizPrev, 0.25f);
 		Velocity.X = Restored.X;
 		Velocity.Y = Restored.Y;
 	}
 }
+
+void UShooterCharacterMovement_Doom::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
+{
+	// Movement is most of a character's tick; charge it to the owner's hosted run
+	FShooterRunTickScope RunTickScope(GetOwner());
+
+	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+}
+
+FNetworkPredictionData_Client* UShooterCharacterMovement_Doom::GetPredictionData_Client() const
+{
+	if (ClientPredictionData == nullptr)
+	{
+		UShooterCharacterMovement_Doom* MutableThis = const_cast<UShooterCharacterMovement_Doom*>(this);
+		MutableThis->ClientPredictionData = new FNetworkPredictionData_Client_ShooterDoom(*this);
+	}
+
+	return ClientPredictionData;
+}
+
+void UShooterCharacterMovement_Doom::UpdateFromCompressedFlags(uint8 Flags)
+{
+	// Sprint (FLAG_Custom_0) is read by the SKG base
+	Super::UpdateFromCompressedFlags(Flags);
+	bWantsToDash = (Flags & FSavedMove_Character::FLAG_Custom_1) != 0;
+}
+
+// --- Correction telemetry ---
+
+void UShooterCharacterMovement_Doom::ServerMoveHandleClientError(float ClientTimeStamp, float DeltaTime, const FVector& Accel, const FVector& RelativeClientLocation,
+	UPrimitiveComponent* ClientMovementBase, FName ClientBaseBoneName, uint8 ClientMovementMode)
+{
+	Super::ServerMoveHandleClientError(ClientTimeStamp, DeltaTime, Accel, RelativeClientLocation, ClientMovementBase, ClientBaseBoneName, ClientMovementMode);
+
+	// First half of a dual move carries a dummy location and is never checked
+	const FNetworkPredictionData_Server_Character* ServerData = GetPredictionData_Server_Character();
+	if (!ServerData || !UpdatedComponent || ServerData->PendingAdjustment.TimeStamp != ClientTimeStamp)
+	{
+		return;
+	}
+
+	UShooterMovementTelemetrySubsystem* Telemetry = GetWorld() ? GetWorld()->GetSubsystem<UShooterMovementTelemetrySubsystem>() : nullptr;
+	if (!Telemetry)
+	{
+		return;
+	}
+
+	const bool bCorrected = !ServerData->PendingAdjustment.bAckGoodMove;
+	float Distance = 0.f;
+
+	if (bCorrected)
+	{
+		FVector ClientLoc = RelativeClientLocation;
+		if (MovementBaseUtility::UseRelativeLocation(ClientMovementBase))
+		{
+			MovementBaseUtility::TransformLocationToWorld(ClientMovementBase, ClientBaseBoneName, RelativeClientLocation, ClientLoc);
+		}
+		else
+		{
+			ClientLoc = FRepMovement::RebaseOntoLocalOrigin(ClientLoc, this);
+		}
+
+		Distance = FVector::Dist(UpdatedComponent->GetComponentLocation(), ClientLoc);
+	}
+
+	Telemetry->RecordServerMove(this, bCorrected, Distance);
+}
+
+void UShooterCharacterMovement_Doom::ServerSetCorrectionTestActive_Implementation(bool bActive)
+{
+#if !UE_BUILD_SHIPPING
+	// Resets and writes server-wide telemetry: cheat-enabled players and the listen-server host only
+	APlayerController* PC = CharacterOwner ? Cast<APlayerController>(CharacterOwner->GetController()) : nullptr;
+	const AGameModeBase* GameMode = GetWorld() ? GetWorld()->GetAuthGameMode() : nullptr;
+	const bool bAllowed = PC && (PC->IsLocalController() || PC->CheatManager || (GameMode && GameMode->AllowCheats(PC)));
+	if (!bAllowed)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("MovementTelemetry: rejected correction test request from %s (cheats disabled)"), *GetNameSafe(GetOwner()));
+		return;
+	}
+
+	UShooterMovementTelemetrySubsystem* Telemetry = GetWorld() ? GetWorld()->GetSubsystem<UShooterMovementTelemetrySubsystem>() : nullptr;
+	if (!Telemetry)
+	{
+		return;
+	}
+
+	if (bActive)
+	{
+		UE_LOG(LogTemp, Log, TEXT("MovementTelemetry: correction test window opened by %s"), *GetNameSafe(GetOwner()));
+		Telemetry->ResetCounters();
+		return;
+	}
+
+	Telemetry->LogReport();
+	Telemetry->WriteCsv();
+#endif
+}
+
+// --- Dash ---
+
+bool UShooterCharacterMovement_Doom::IsDashing() const
+{
+	return MovementMode == MOVE_Custom && CustomMovementMode == (uint8)EShooterCustomMovementMode::Dash;
+}
+
+void UShooterCharacterMovement_Doom::UpdateCharacterStateBeforeMovement(float DeltaSeconds)
+{
+	Super::UpdateCharacterStateBeforeMovement(DeltaSeconds);
+
+	// Runs inside the move on the client, the server and during replay, so all three dash on the same frame
+	if (bWantsToDash)
+	{
+		bWantsToDash = false;
+
+		if (CanStartDash() && ConsumeServerDashAuthorization())
+		{
+			StartDash();
+		}
+	}
+}
+
+void UShooterCharacterMovement_Doom::AuthorizeServerDash()
+{
+	if (CharacterOwner && CharacterOwner->HasAuthority())
+	{
+		ServerDashAuthorizedUntil = GetWorld()->GetTimeSeconds() + CVarDashAuthorizationWindow.GetValueOnGameThread();
+	}
+}
+
+bool UShooterCharacterMovement_Doom::ConsumeServerDashAuthorization()
+{
+	// Owning clients, replays and the listen-server host dash on their own input
+	if (!CharacterOwner->HasAuthority() || CharacterOwner->IsLocallyControlled())
+	{
+		return true;
+	}
+
+	const bool bAuthorized = ServerDashAuthorizedUntil >= GetWorld()->GetTimeSeconds();
+	ServerDashAuthorizedUntil = -1.0;
+
+	if (!bAuthorized)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("[DOOM MOVE] Rejected unauthorized dash from %s"), *GetNameSafe(CharacterOwner));
+	}
+
+	return bAuthorized;
+}
+
+bool UShooterCharacterMovement_Doom::CanStartDash() const
+{
+	if (!UpdatedComponent || !CharacterOwner || HasAnimRootMotion())
+	{
+		return false;
+	}
+
+	// Re-dashing mid-dash restarts it (chaining is gated by the ability)
+	return IsMovingOnGround() || IsDashing() || (IsFalling() && bAllowAirDash);
+}
+
+void UShooterCharacterMovement_Doom::StartDash()
+{
+	const bool bOnGround = IsMovingOnGround() || (IsDashing() && bDashStartedOnGround);
+
+	// Input direction from the move's acceleration, else straight ahead (actor yaw follows the controller)
+	FVector Direction = Acceleration.GetSafeNormal2D();
+	if (Direction.IsNearlyZero())
+	{
+		Direction = CharacterOwner->GetActorForwardVector().GetSafeNormal2D();
+	}
+
+	DashVelocity = Direction * DashSpeed * (bOnGround ? 1.f : AirDashSpeedMultiplier);
+	DashTimeRemaining = DashDuration;
+	bDashStartedOnGround = bOnGround;
+
+	Velocity = DashVelocity;
+	SetMovementMode(MOVE_Custom, (uint8)EShooterCustomMovementMode::Dash);
+}
+
+void UShooterCharacterMovement_Doom::PhysCustom(float DeltaTime, int32 Iterations)
+{
+	if (CustomMovementMode == (uint8)EShooterCustomMovementMode::Dash)
+	{
+		PhysDash(DeltaTime, Iterations);
+		return;
+	}
+
+	Super::PhysCustom(DeltaTime, Iterations);
+}
+
+void UShooterCharacterMovement_Doom::PhysDash(float DeltaTime, int32 Iterations)
+{
+	if (DeltaTime < MIN_TICK_TIME || !UpdatedComponent)
+	{
+		return;
+	}
+
+	const float TimeTick = FMath::Min(DeltaTime, DashTimeRemaining);
+	DashTimeRemaining -= TimeTick;
+
+	// Constant horizontal velocity, no gravity or friction: nothing outside the move can change the result
+	Velocity = DashVelocity;
+
+	const FVector Delta = Velocity * TimeTick;
+	FHitResult Hit(1.f);
+	SafeMoveUpdatedComponent(Delta, UpdatedComponent->GetComponentQuat(), true, Hit);
+
+	if (Hit.IsValidBlockingHit())
+	{
+		HandleImpact(Hit, TimeTick, Delta);
+		SlideAlongSurface(Delta, 1.f - Hit.Time, Hit.Normal, Hit, true);
+	}
+
+	// Ground dashes follow steps and slopes instead of flying off them
+	if (bDashStartedOnGround)
+	{
+		FindFloor(UpdatedComponent->GetComponentLocation(), CurrentFloor, false);
+		if (CurrentFloor.IsWalkableFloor())
+		{
+			AdjustFloorHeight();
+		}
+	}
+
+	if (DashTimeRemaining <= 0.f)
+	{
+		EndDash();
+
+		const float RemainingTime = DeltaTime - TimeTick;
+		if (RemainingTime >= MIN_TICK_TIME)
+		{
+			StartNewPhysics(RemainingTime, Iterations);
+		}
+	}
+}
+
+void UShooterCharacterMovement_Doom::EndDash()
+{
+	DashTimeRemaining = 0.f;
+
+	const float ExitSpeed = FMath::Min(DashVelocity.Size2D(), DashExitSpeed);
+	Velocity = DashVelocity.GetSafeNormal2D() * ExitSpeed;
+
+	FFindFloorResult Floor;
+	FindFloor(UpdatedComponent->GetComponentLocation(), Floor, false);
+	SetMovementMode(Floor.IsWalkableFloor() ? MOVE_Walking : MOVE_Falling);
+}
+
+// --- Saved move ---
+
+bool FSavedMove_ShooterDoom::CanCombineWith(const FSavedMovePtr& NewMove, ACharacter* InCharacter, float MaxDelta) const
+{
+	const FSavedMove_ShooterDoom* Other = static_cast<const FSavedMove_ShooterDoom*>(NewMove.Get());
+
+	// A dash start must stay its own move so it replays on the same frame
+	if (bSavedWantsToSprint != Other->bSavedWantsToSprint || bSavedWantsToDash || Other->bSavedWantsToDash)
+	{
+		return false;
+	}
+
+	return Super::CanCombineWith(NewMove, InCharacter, MaxDelta);
+}
+
+void FSavedMove_ShooterDoom::Clear()
+{
+	Super::Clear();
+
+	bSavedWantsToSprint = false;
+	bSavedWantsToDash = false;
+	SavedDashTimeRemaining = 0.f;
+	SavedDashVelocity = FVector::ZeroVector;
+	bSavedDashStartedOnGround = false;
+}
+
+void FSavedMove_ShooterDoom::SetMoveFor(ACharacter* C, float InDeltaTime, FVector const& NewAccel, FNetworkPredictionData_Client_Character& ClientData)
+{
+	Super::SetMoveFor(C, InDeltaTime, NewAccel, ClientData);
+
+	if (const UShooterCharacterMovement_Doom* Move = Cast<UShooterCharacterMovement_Doom>(C->GetCharacterMovement()))
+	{
+		bSavedWantsToSprint = Move->bWantsToSprint;
+		bSavedWantsToDash = Move->bWantsToDash;
+		SavedDashTimeRemaining = Move->DashTimeRemaining;
+		SavedDashVelocity = Move->DashVelocity;
+		bSavedDashStartedOnGround = Move->bDashStartedOnGround;
+	}
+}
+
+void FSavedMove_ShooterDoom::PrepMoveFor(ACharacter* C)
+{
+	Super::PrepMoveFor(C);
+
+	if (UShooterCharacterMovement_Doom* Move = Cast<UShooterCharacterMovement_Doom>(C->GetCharacterMovement()))
+	{
+		Move->bWantsToSprint = bSavedWantsToSprint;
+		Move->bWantsToDash = bSavedWantsToDash;
+		Move->DashTimeRemaining = SavedDashTimeRemaining;
+		Move->DashVelocity = SavedDashVelocity;
+		Move->bDashStartedOnGround = bSavedDashStartedOnGround;
+	}
+}
+
+uint8 FSavedMove_ShooterDoom::GetCompressedFlags() const
+{
+	uint8 Result = Super::GetCompressedFlags();
+
+	if (bSavedWantsToSprint)
+	{
+		Result |= FLAG_Custom_0;
+	}
+	if (bSavedWantsToDash)
+	{
+		Result |= FLAG_Custom_1;
+	}
+
+	return Result;
+}
+
+FNetworkPredictionData_Client_ShooterDoom::FNetworkPredictionData_Client_ShooterDoom(const UCharacterMovementComponent& ClientMovement)
+	: Super(ClientMovement)
+{
+}
+
+FSavedMovePtr FNetworkPredictionData_Client_ShooterDoom::AllocateNewMove()
+{
+	return FSavedMovePtr(new FSavedMove_ShooterDoom());
+}
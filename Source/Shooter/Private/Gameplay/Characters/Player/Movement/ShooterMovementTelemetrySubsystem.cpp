@@ -0,0 +1,411 @@
+#include "Gameplay/Characters/Player/Movement/ShooterMovementTelemetrySubsystem.h"
+#include "Gameplay/Characters/Player/Movement/ShooterCharacterMovement_Doom.h"
+#include "Gameplay/Characters/ShooterCombatCharacter.h"
+
+#include "Engine/World.h"
+#include "GameFramework/Character.h"
+#include "GameFramework/PlayerController.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/DateTime.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "ProfilingDebugging/CountersTrace.h"
+#include "ProfilingDebugging/CsvProfiler.h"
+
+DECLARE_STATS_GROUP(TEXT("ShooterMovement"), STATGROUP_ShooterMovement, STATCAT_Advanced);
+
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Server Moves"), STAT_ShooterMoveServerMoves, STATGROUP_ShooterMovement);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Corrections"), STAT_ShooterMoveCorrections, STATGROUP_ShooterMovement);
+DECLARE_FLOAT_COUNTER_STAT(TEXT("Max Correction Distance"), STAT_ShooterMoveMaxCorrection, STATGROUP_ShooterMovement);
+
+CSV_DEFINE_CATEGORY(ShooterMovement, true);
+
+TRACE_DECLARE_INT_COUNTER(ShooterMoveCorrections, TEXT("ShooterMovement/Corrections"));
+TRACE_DECLARE_INT_COUNTER(ShooterMoveCorrectionsWalking, TEXT("ShooterMovement/Corrections/Walking"));
+TRACE_DECLARE_INT_COUNTER(ShooterMoveCorrectionsFalling, TEXT("ShooterMovement/Corrections/Falling"));
+TRACE_DECLARE_INT_COUNTER(ShooterMoveCorrectionsDash, TEXT("ShooterMovement/Corrections/Dash"));
+TRACE_DECLARE_FLOAT_COUNTER(ShooterMoveCorrectionDistance, TEXT("ShooterMovement/CorrectionDistance"));
+
+static TAutoConsoleVariable<int32> CVarMovementTelemetry(
+    TEXT("colosseum.Movement.Telemetry"),
+    1,
+    TEXT("Record server-side movement corrections (0 = off)."),
+    ECVF_Cheat);
+
+static FAutoConsoleCommandWithWorld CmdMovementTelemetryReport(
+    TEXT("colosseum.Movement.TelemetryReport"),
+    TEXT("Logs movement correction counts per mode and writes them to Saved/Profiling/MovementTelemetry_*.csv (server)."),
+    FConsoleCommandWithWorldDelegate::CreateLambda([](UWorld* World)
+    {
+        if (UShooterMovementTelemetrySubsystem* Telemetry = World ? World->GetSubsystem<UShooterMovementTelemetrySubsystem>() : nullptr)
+        {
+            Telemetry->LogReport();
+            Telemetry->WriteCsv();
+        }
+    }));
+
+static FAutoConsoleCommandWithWorld CmdMovementTelemetryReset(
+    TEXT("colosseum.Movement.TelemetryReset"),
+    TEXT("Clears the movement correction counters."),
+    FConsoleCommandWithWorldDelegate::CreateLambda([](UWorld* World)
+    {
+        if (UShooterMovementTelemetrySubsystem* Telemetry = World ? World->GetSubsystem<UShooterMovementTelemetrySubsystem>() : nullptr)
+        {
+            Telemetry->ResetCounters();
+        }
+    }));
+
+static FAutoConsoleCommandWithWorldAndArgs CmdMovementCorrectionTest(
+    TEXT("colosseum.Movement.CorrectionTest"),
+    TEXT("colosseum.Movement.CorrectionTest <Seconds=30> <LagMs=100> <LossPct=2>: run on a client; scripted movement under net emulation, the server logs and writes the correction report."),
+    FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+    {
+        UShooterMovementTelemetrySubsystem* Telemetry = World ? World->GetSubsystem<UShooterMovementTelemetrySubsystem>() : nullptr;
+        if (!Telemetry)
+        {
+            return;
+        }
+
+        const float Seconds = Args.Num() > 0 ? FCString::Atof(*Args[0]) : 30.f;
+        const int32 LagMs = Args.Num() > 1 ? FCString::Atoi(*Args[1]) : 100;
+        const float LossPercent = Args.Num() > 2 ? FCString::Atof(*Args[2]) : 2.f;
+        Telemetry->StartCorrectionTest(Seconds, LagMs, LossPercent);
+    }));
+
+static const TCHAR* GetTelemetryModeName(int32 Mode)
+{
+    switch ((EShooterMoveTelemetryMode)Mode)
+    {
+    case EShooterMoveTelemetryMode::Walking: return TEXT("Walking");
+    case EShooterMoveTelemetryMode::Falling: return TEXT("Falling");
+    case EShooterMoveTelemetryMode::Dash:    return TEXT("Dash");
+    default:                                 return TEXT("Other");
+    }
+}
+
+TStatId UShooterMovementTelemetrySubsystem::GetStatId() const
+{
+    RETURN_QUICK_DECLARE_CYCLE_STAT(UShooterMovementTelemetrySubsystem, STATGROUP_Tickables);
+}
+
+void UShooterMovementTelemetrySubsystem::Tick(float DeltaTime)
+{
+    if (bCorrectionTestRunning)
+    {
+        TickCorrectionTest(DeltaTime);
+    }
+}
+
+// --- Recording (server) ---
+
+EShooterMoveTelemetryMode UShooterMovementTelemetrySubsystem::GetTelemetryMode(const UCharacterMovementComponent* Move)
+{
+    if (const UShooterCharacterMovement_Doom* DoomMove = Cast<UShooterCharacterMovement_Doom>(Move))
+    {
+        if (DoomMove->IsDashing())
+        {
+            return EShooterMoveTelemetryMode::Dash;
+        }
+    }
+
+    if (Move->IsMovingOnGround())
+    {
+        return EShooterMoveTelemetryMode::Walking;
+    }
+
+    return Move->IsFalling() ? EShooterMoveTelemetryMode::Falling : EShooterMoveTelemetryMode::Other;
+}
+
+int32 UShooterMovementTelemetrySubsystem::GetDistanceBucket(float Distance)
+{
+    for (int32 i = 0; i < ShooterMoveTelemetry::NumDistanceBuckets - 1; ++i)
+    {
+        if (Distance < ShooterMoveTelemetry::DistanceBucketEdges[i])
+        {
+            return i;
+        }
+    }
+
+    return ShooterMoveTelemetry::NumDistanceBuckets - 1;
+}
+
+void UShooterMovementTelemetrySubsystem::RecordServerMove(const UCharacterMovementComponent* Move, bool bCorrected, float CorrectionDistance)
+{
+    if (!Move || CVarMovementTelemetry.GetValueOnGameThread() == 0)
+    {
+        return;
+    }
+
+    if (WindowStartTime <= 0.0)
+    {
+        WindowStartTime = FPlatformTime::Seconds();
+    }
+
+    const EShooterMoveTelemetryMode Mode = GetTelemetryMode(Move);
+    FShooterMoveModeStats& Stats = ModeStats[(int32)Mode];
+
+    ++Stats.ServerMoves;
+    INC_DWORD_STAT(STAT_ShooterMoveServerMoves);
+    CSV_CUSTOM_STAT(ShooterMovement, ServerMoves, 1, ECsvCustomStatOp::Accumulate);
+
+    if (!bCorrected)
+    {
+        return;
+    }
+
+    ++Stats.Corrections;
+    Stats.TotalCorrectionDistance += CorrectionDistance;
+    Stats.MaxCorrectionDistance = FMath::Max(Stats.MaxCorrectionDistance, CorrectionDistance);
+    ++Stats.DistanceHistogram[GetDistanceBucket(CorrectionDistance)];
+
+    INC_DWORD_STAT(STAT_ShooterMoveCorrections);
+    SET_FLOAT_STAT(STAT_ShooterMoveMaxCorrection, Stats.MaxCorrectionDistance);
+
+    CSV_CUSTOM_STAT(ShooterMovement, Corrections, 1, ECsvCustomStatOp::Accumulate);
+    CSV_CUSTOM_STAT(ShooterMovement, CorrectionDistance, CorrectionDistance, ECsvCustomStatOp::Max);
+
+    TRACE_COUNTER_INCREMENT(ShooterMoveCorrections);
+    TRACE_COUNTER_SET(ShooterMoveCorrectionDistance, CorrectionDistance);
+
+    switch (Mode)
+    {
+    case EShooterMoveTelemetryMode::Walking:
+        CSV_CUSTOM_STAT(ShooterMovement, CorrectionsWalking, 1, ECsvCustomStatOp::Accumulate);
+        TRACE_COUNTER_INCREMENT(ShooterMoveCorrectionsWalking);
+        break;
+    case EShooterMoveTelemetryMode::Falling:
+        CSV_CUSTOM_STAT(ShooterMovement, CorrectionsFalling, 1, ECsvCustomStatOp::Accumulate);
+        TRACE_COUNTER_INCREMENT(ShooterMoveCorrectionsFalling);
+        break;
+    case EShooterMoveTelemetryMode::Dash:
+        CSV_CUSTOM_STAT(ShooterMovement, CorrectionsDash, 1, ECsvCustomStatOp::Accumulate);
+        TRACE_COUNTER_INCREMENT(ShooterMoveCorrectionsDash);
+        break;
+    default:
+        break;
+    }
+}
+
+void UShooterMovementTelemetrySubsystem::ResetCounters()
+{
+    for (FShooterMoveModeStats& Stats : ModeStats)
+    {
+        Stats = FShooterMoveModeStats();
+    }
+
+    WindowStartTime = FPlatformTime::Seconds();
+}
+
+// --- Reporting ---
+
+void UShooterMovementTelemetrySubsystem::LogReport() const
+{
+    const double WindowSeconds = WindowStartTime > 0.0 ? FPlatformTime::Seconds() - WindowStartTime : 0.0;
+
+    int64 TotalMoves = 0;
+    int64 TotalCorrections = 0;
+    for (const FShooterMoveModeStats& Stats : ModeStats)
+    {
+        TotalMoves += Stats.ServerMoves;
+        TotalCorrections += Stats.Corrections;
+    }
+
+    UE_LOG(LogTemp, Log, TEXT("MovementTelemetry: %.1fs, %lld server moves, %lld corrections (%.2f%%)"),
+        WindowSeconds, TotalMoves, TotalCorrections,
+        TotalMoves > 0 ? 100.0 * TotalCorrections / TotalMoves : 0.0);
+
+    for (int32 Mode = 0; Mode < (int32)EShooterMoveTelemetryMode::Num; ++Mode)
+    {
+        const FShooterMoveModeStats& Stats = ModeStats[Mode];
+        if (Stats.ServerMoves == 0)
+        {
+            continue;
+        }
+
+        FString Histogram;
+        for (int32 Bucket = 0; Bucket < ShooterMoveTelemetry::NumDistanceBuckets; ++Bucket)
+        {
+            Histogram += FString::Printf(TEXT(" %lld"), Stats.DistanceHistogram[Bucket]);
+        }
+
+        UE_LOG(LogTemp, Log, TEXT("MovementTelemetry:   %-8s moves=%lld corrections=%lld (%.2f%%) avg=%.1fcm max=%.1fcm histogram[<1,<5,<10,<25,<50,<100,100+]:%s"),
+            GetTelemetryModeName(Mode), Stats.ServerMoves, Stats.Corrections,
+            100.0 * Stats.Corrections / Stats.ServerMoves,
+            Stats.Corrections > 0 ? Stats.TotalCorrectionDistance / Stats.Corrections : 0.0,
+            Stats.MaxCorrectionDistance, *Histogram);
+    }
+}
+
+FString UShooterMovementTelemetrySubsystem::WriteCsv() const
+{
+    FString Csv = TEXT("Mode,ServerMoves,Corrections,CorrectionRatePct,AvgDistance,MaxDistance");
+    for (int32 Bucket = 0; Bucket < ShooterMoveTelemetry::NumDistanceBuckets; ++Bucket)
+    {
+        Csv += Bucket < ShooterMoveTelemetry::NumDistanceBuckets - 1
+            ? FString::Printf(TEXT(",Lt%.0f"), ShooterMoveTelemetry::DistanceBucketEdges[Bucket])
+            : FString::Printf(TEXT(",Ge%.0f"), ShooterMoveTelemetry::DistanceBucketEdges[Bucket - 1]);
+    }
+    Csv += LINE_TERMINATOR;
+
+    for (int32 Mode = 0; Mode < (int32)EShooterMoveTelemetryMode::Num; ++Mode)
+    {
+        const FShooterMoveModeStats& Stats = ModeStats[Mode];
+
+        Csv += FString::Printf(TEXT("%s,%lld,%lld,%.3f,%.2f,%.2f"),
+            GetTelemetryModeName(Mode), Stats.ServerMoves, Stats.Corrections,
+            Stats.ServerMoves > 0 ? 100.0 * Stats.Corrections / Stats.ServerMoves : 0.0,
+            Stats.Corrections > 0 ? Stats.TotalCorrectionDistance / Stats.Corrections : 0.0,
+            Stats.MaxCorrectionDistance);
+
+        for (int32 Bucket = 0; Bucket < ShooterMoveTelemetry::NumDistanceBuckets; ++Bucket)
+        {
+            Csv += FString::Printf(TEXT(",%lld"), Stats.DistanceHistogram[Bucket]);
+        }
+        Csv += LINE_TERMINATOR;
+    }
+
+    const FString Path = FPaths::ProfilingDir() / FString::Printf(TEXT("MovementTelemetry_%s.csv"), *FDateTime::Now().ToString());
+    if (!FFileHelper::SaveStringToFile(Csv, *Path))
+    {
+        UE_LOG(LogTemp, Warning, TEXT("MovementTelemetry: failed to write %s"), *Path);
+        return FString();
+    }
+
+    UE_LOG(LogTemp, Log, TEXT("MovementTelemetry: wrote %s"), *Path);
+    return Path;
+}
+
+// --- Correction test (client) ---
+
+void UShooterMovementTelemetrySubsystem::StartCorrectionTest(float Seconds, int32 LagMs, float LossPercent)
+{
+    UWorld* World = GetWorld();
+    APlayerController* PC = World ? World->GetFirstPlayerController() : nullptr;
+    ACharacter* Character = PC ? Cast<ACharacter>(PC->GetPawn()) : nullptr;
+    UShooterCharacterMovement_Doom* Move = Character ? Cast<UShooterCharacterMovement_Doom>(Character->GetCharacterMovement()) : nullptr;
+
+    if (!Move || bCorrectionTestRunning)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("MovementTelemetry: correction test needs a local Doom-movement pawn and no test in progress"));
+        return;
+    }
+
+    if (World->GetNetMode() != NM_Client)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("MovementTelemetry: not a client, the local pawn is never corrected; results only cover remote players"));
+    }
+
+    SetNetEmulation(LagMs, LossPercent);
+
+    TestPawn = Character;
+    TestElapsed = 0.f;
+    TestDuration = FMath::Max(Seconds, 1.f);
+    NextJumpTime = 1.f;
+    NextDashTime = 2.f;
+    bJumpHeld = false;
+    bCorrectionTestRunning = true;
+
+#if !UE_BUILD_SHIPPING
+    Move->ServerSetCorrectionTestActive(true);
+#endif
+
+    UE_LOG(LogTemp, Log, TEXT("MovementTelemetry: correction test started (%.0fs, lag %dms, loss %.1f%%)"), TestDuration, LagMs, LossPercent);
+}
+
+void UShooterMovementTelemetrySubsystem::TickCorrectionTest(float DeltaTime)
+{
+    ACharacter* Character = TestPawn.Get();
+    UShooterCharacterMovement_Doom* Move = Character ? Cast<UShooterCharacterMovement_Doom>(Character->GetCharacterMovement()) : nullptr;
+    if (!Move)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("MovementTelemetry: test pawn lost, stopping correction test"));
+        FinishCorrectionTest();
+        return;
+    }
+
+    TestElapsed += DeltaTime;
+
+    // Circle strafe, sprinting every other 3s, with regular jumps and dashes (ground and air)
+    const FVector Direction = FRotator(0.f, TestElapsed * 90.f, 0.f).Vector();
+    Character->AddMovementInput(Direction, 1.f);
+    Move->bWantsToSprint = FMath::Fmod(TestElapsed, 6.f) < 3.f;
+
+    if (bJumpHeld)
+    {
+        Character->StopJumping();
+        bJumpHeld = false;
+    }
+
+    if (TestElapsed >= NextJumpTime)
+    {
+        Character->Jump();
+        bJumpHeld = true;
+        NextJumpTime += 1.7f;
+    }
+
+    // Through the dash ability, so the server authorizes the dash like a player's
+    AShooterCombatCharacter* CombatCharacter = Cast<AShooterCombatCharacter>(Character);
+    if (CombatCharacter && TestElapsed >= NextDashTime)
+    {
+        CombatCharacter->TryActivateDashAbility();
+        NextDashTime += 2.3f;
+    }
+
+    if (TestElapsed >= TestDuration)
+    {
+        FinishCorrectionTest();
+    }
+}
+
+void UShooterMovementTelemetrySubsystem::FinishCorrectionTest()
+{
+    bCorrectionTestRunning = false;
+
+    if (ACharacter* Character = TestPawn.Get())
+    {
+        Character->StopJumping();
+
+        if (UShooterCharacterMovement_Doom* Move = Cast<UShooterCharacterMovement_Doom>(Character->GetCharacterMovement()))
+        {
+            Move->bWantsToSprint = false;
+#if !UE_BUILD_SHIPPING
+            Move->ServerSetCorrectionTestActive(false);
+#endif
+        }
+    }
+
+    IConsoleManager& Console = IConsoleManager::Get();
+    if (IConsoleVariable* PktLag = Console.FindConsoleVariable(TEXT("NetEmulation.PktLag")))
+    {
+        PktLag->Set(*SavedPktLag, ECVF_SetByConsole);
+    }
+    if (IConsoleVariable* PktLoss = Console.FindConsoleVariable(TEXT("NetEmulation.PktLoss")))
+    {
+        PktLoss->Set(*SavedPktLoss, ECVF_SetByConsole);
+    }
+
+    TestPawn.Reset();
+
+    UE_LOG(LogTemp, Log, TEXT("MovementTelemetry: correction test finished after %.1fs, see the server log/CSV for results"), TestElapsed);
+}
+
+void UShooterMovementTelemetrySubsystem::SetNetEmulation(int32 LagMs, float LossPercent)
+{
+    // Only present in builds with net emulation compiled in (not Shipping)
+    IConsoleManager& Console = IConsoleManager::Get();
+    IConsoleVariable* PktLag = Console.FindConsoleVariable(TEXT("NetEmulation.PktLag"));
+    IConsoleVariable* PktLoss = Console.FindConsoleVariable(TEXT("NetEmulation.PktLoss"));
+
+    if (!PktLag || !PktLoss)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("MovementTelemetry: net emulation not available in this build, running without lag/loss"));
+        return;
+    }
+
+    SavedPktLag = PktLag->GetString();
+    SavedPktLoss = PktLoss->GetString();
+
+    PktLag->Set(LagMs, ECVF_SetByConsole);
+    PktLoss->Set(FMath::RoundToInt(LossPercent), ECVF_SetByConsole);
+}
@@ -7,6 +7,7 @@
 #include "Net/UnrealNetwork.h"
 #include "GameFramework/PlayerState.h"
 #include "GameFramework/PlayerController.h"
+#include "GameFramework/GameStateBase.h"
 #include "Camera/CameraComponent.h"
 #include "GameFramework/SpringArmComponent.h"
 #include "Components/CapsuleComponent.h"
@@ -25,6 +26,9 @@
 #include "Gameplay/Combat/Weapons/Firearms/ShooterFirearm.h"
 #include "Gameplay/Characters/Player/Movement/ShooterCharacterMovement_Doom.h"
 #include "Gameplay/Augments/AugmentManagerComponent.h"
+#include "Gameplay/Interaction/InteractionFocusComponent.h"
+#include "Gameplay/Net/ShooterPushModel.h"
+#include "Gameplay/Run/ShooterRunHostSubsystem.h"
 
 AShooterCharacter::AShooterCharacter(const FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer)
@@ -42,6 +46,7 @@ AShooterCharacter::AShooterCharacter(const FObjectInitializer& ObjectInitializer
     GetMesh()->SetRelativeRotation(FRotator(0.f, -90.f, 0.f));  // face +X
 
 	AugmentManager = CreateDefaultSubobject<UAugmentManagerComponent>("AugmentManager");
+	InteractionFocus = CreateDefaultSubobject<UInteractionFocusComponent>(TEXT("InteractionFocus"));
 
     // -----------------------------
     // Third-person spring arm + camera
@@ -84,8 +89,6 @@ AShooterCharacter::AShooterCharacter(const FObjectInitializer& ObjectInitializer
     // Dash setup
     // -----------------------------
     MaxDashCharges = 2;
-    CurrentDashCharges = MaxDashCharges;
-    Rep_CurrentDashCharges = CurrentDashCharges;
 
     bRefillAllAtOnce = true;
     RefillAllDelay = 0.80f;
@@ -94,20 +97,27 @@ AShooterCharacter::AShooterCharacter(const FObjectInitializer& ObjectInitializer
     // Default to first-person mode
     bUseThirdPersonCamera = false;
 
-    UE_LOG(LogTemp, Warning, TEXT("Dash[Char]: Ctor: Max=%d Curr=%d Delay=%.2f"), MaxDashCharges, CurrentDashCharges, DashRechargeDelay);
+    UE_LOG(LogTemp, Warning, TEXT("Dash[Char]: Ctor: Max=%d Delay=%.2f"), MaxDashCharges, DashRechargeDelay);
 }
 
 void AShooterCharacter::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
 {
 	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
-	DOREPLIFETIME_CONDITION(AShooterCharacter, Rep_CurrentDashCharges, COND_OwnerOnly);
-	DOREPLIFETIME(AShooterCharacter, bUseThirdPersonCamera);
-	DOREPLIFETIME(AShooterCharacter, AugmentManager);
+
+	FDoRepLifetimeParams Params;
+	Params.bIsPushBased = true;
+	DOREPLIFETIME_WITH_PARAMS_FAST(AShooterCharacter, bUseThirdPersonCamera, Params);
+	DOREPLIFETIME_WITH_PARAMS_FAST(AShooterCharacter, AugmentManager, Params);
+
+	Params.Condition = COND_OwnerOnly;
+	DOREPLIFETIME_WITH_PARAMS_FAST(AShooterCharacter, DashChargeState, Params);
 }
 
 void AShooterCharacter::OnRep_DashCharges()
 {
-	CurrentDashCharges = Rep_CurrentDashCharges;
+	// The server's consume replaces whatever this client predicted
+	UE_LOG(LogTemp, Verbose, TEXT("Dash[Char]: OnRep_DashCharges: Used=%d Last=%.3f -> Curr=%d/%d"),
+		DashChargeState.ChargesUsed, DashChargeState.LastConsumeTime, GetCurrentDashCharges(), MaxDashCharges);
 }
 
 void AShooterCharacter::BeginPlay()
@@ -118,8 +128,7 @@ void AShooterCharacter::BeginPlay()
 	ApplyCameraMode();
 	UpdateControllerPitchClamp();
 
-	CurrentDashCharges = FMath::Clamp(CurrentDashCharges, 0, MaxDashCharges);
-	UE_LOG(LogTemp, Warning, TEXT("Dash[Char]: BeginPlay: Curr=%d/%d"), CurrentDashCharges, MaxDashCharges);
+	UE_LOG(LogTemp, Warning, TEXT("Dash[Char]: BeginPlay: Curr=%d/%d"), GetCurrentDashCharges(), MaxDashCharges);
 
 	if (AugmentManager)
 	{
@@ -147,9 +156,9 @@ void AShooterCharacter::PossessedBy(AController* NewController)
 
 	if (HasAuthority())
 	{
-		CurrentDashCharges = MaxDashCharges;
-		Rep_CurrentDashCharges = CurrentDashCharges;
-		UE_LOG(LogTemp, Warning, TEXT("Dash[Char]: PossessedBy: Top-up -> Curr=%d/%d"), CurrentDashCharges, MaxDashCharges);
+		DashChargeState = FShooterDashChargeState();
+		SHOOTER_MARK_DIRTY(AShooterCharacter, DashChargeState, this);
+		UE_LOG(LogTemp, Warning, TEXT("Dash[Char]: PossessedBy: Top-up -> Curr=%d/%d"), GetCurrentDashCharges(), MaxDashCharges);
 	}
 
 	ConfigureCameraDefaultsOnce();
@@ -424,28 +433,6 @@ void AShooterCharacter::GrantStartupAbilities()
 		return;
 	}
 
-	bool bAlreadyHasDash = false;
-	for (const FGameplayAbilitySpec& Spec : ASC->GetActivatableAbilities())
-	{
-		if (Spec.Ability && Spec.Ability->GetClass() == DashAbilityClass)
-		{
-			bAlreadyHasDash = true;
-			break;
-		}
-	}
-
-	if (!bAlreadyHasDash && DashAbilityClass)
-	{
-		FGameplayAbilitySpec Spec(DashAbilityClass, 1, INDEX_NONE, this);
-		Spec.GetDynamicSpecSourceTags().AddTag(ShooterTags::Ability_Movement_Dash);
-		ASC->GiveAbility(Spec);
-		UE_LOG(LogTemp, Warning, TEXT("Dash[Char]: GrantStartupAbilities: Gave DashAbility"));
-	}
-	else
-	{
-		UE_LOG(LogTemp, Warning, TEXT("Dash[Char]: GrantStartupAbilities: Skipped (already has dash)"));
-	}
-
 	// --- Interact Ability ---
 	bool bHasInteract = false;
 	for (const FGameplayAbilitySpec& Spec : ASC->GetActivatableAbilities())
@@ -480,95 +467,72 @@ bool AShooterCharacter::IsInIFrame() const
 
 void AShooterCharacter::ServerTryActivateDash_Implementation()
 {
-	if (ASC)
-	{
-		ASC->TryActivateAbilitiesByTag(FGameplayTagContainer(ShooterTags::Ability_Movement_Dash));
-	}
+	TryActivateDashAbility();
 }
 
 // --- Charges -------------------------------------------------------------------------------------
 
-bool AShooterCharacter::ConsumeDashCharge()
+double AShooterCharacter::GetDashClockSeconds() const
 {
-	if (HasAuthority())
+	const UWorld* World = GetWorld();
+	if (!World)
 	{
-		if (CurrentDashCharges <= 0) return false;
-		--CurrentDashCharges;
-		Rep_CurrentDashCharges = CurrentDashCharges;
-		UE_LOG(LogTemp, Warning, TEXT("Dash[Char]: ConsumeDashCharge OK (server): Curr=%d/%d"), CurrentDashCharges, MaxDashCharges);
-
-		EnsureDashRechargeRunning();
-		return true;
+		return 0.0;
 	}
 
-	if (CurrentDashCharges <= 0) return false;
-	--CurrentDashCharges;
-	UE_LOG(LogTemp, Warning, TEXT("Dash[Char]: ConsumeDashCharge (client predict): Curr=%d/%d"), CurrentDashCharges, MaxDashCharges);
-	return true;
+	const AGameStateBase* GameState = World->GetGameState();
+	return GameState ? GameState->GetServerWorldTimeSeconds() : World->GetTimeSeconds();
 }
 
-void AShooterCharacter::EnsureDashRechargeRunning()
+int32 AShooterCharacter::GetDashChargesAt(double Time) const
 {
-	if (!HasAuthority()) return;
-	if (CurrentDashCharges >= MaxDashCharges) return;
+	const double SinceConsume = Time - DashChargeState.LastConsumeTime;
+	int32 Missing = DashChargeState.ChargesUsed;
 
-	// Hades-like: single refill to max after a short delay from the last dash
+	// Hades-like: everything refills a short delay after the last dash
 	if (bRefillAllAtOnce)
 	{
-		GetWorldTimerManager().ClearTimer(DashRechargeTimer);
-		GetWorldTimerManager().SetTimer(
-			DashRechargeTimer,
-			this,
-			&AShooterCharacter::OnRefillAllTimer,
-			FMath::Max(0.01f, RefillAllDelay),
-			false);
-
-		UE_LOG(LogTemp, Warning, TEXT("Dash[Char]: RefillAll timer (%.2fs) scheduled/reset. Curr=%d/%d"),
-			RefillAllDelay, CurrentDashCharges, MaxDashCharges);
-		return;
+		if (SinceConsume >= FMath::Max(0.01f, RefillAllDelay))
+		{
+			Missing = 0;
+		}
+	}
+	// Per charge: one back every DashRechargeDelay, restarting at each consume
+	else
+	{
+		const double Delay = DashRechargeDelay > 0.f ? DashRechargeDelay : 1.0;
+		Missing -= FMath::FloorToInt(SinceConsume / Delay);
 	}
 
-	// Legacy per-charge ticking
-	if (DashRechargeDelay <= 0.f) { DashRechargeDelay = 1.0f; }
-
-	GetWorldTimerManager().SetTimer(
-		DashRechargeTimer,
-		this,
-		&AShooterCharacter::DashRechargeTick_PerCharge,
-		DashRechargeDelay,
-		true);
+	return MaxDashCharges - FMath::Clamp(Missing, 0, MaxDashCharges);
+}
 
-	UE_LOG(LogTemp, Warning, TEXT("Dash[Char]: EnsureDashRechargeRunning: Start per-charge timer (Delay=%.2f) Curr=%d/%d"),
-		DashRechargeDelay, CurrentDashCharges, MaxDashCharges);
+int32 AShooterCharacter::GetCurrentDashCharges() const
+{
+	return GetDashChargesAt(GetDashClockSeconds());
 }
 
-void AShooterCharacter::OnRefillAllTimer()
+bool AShooterCharacter::ConsumeDashCharge()
 {
-	if (!HasAuthority()) return;
+	// Same evaluation on the server and the owning client; the client's result is replaced by OnRep
+	const double Now = GetDashClockSeconds();
+	const int32 Charges = GetDashChargesAt(Now);
+	if (Charges <= 0) return false;
 
-	CurrentDashCharges = MaxDashCharges;
-	Rep_CurrentDashCharges = CurrentDashCharges;
-	GetWorldTimerManager().ClearTimer(DashRechargeTimer);
+	DashChargeState.ChargesUsed = (uint8)(MaxDashCharges - Charges + 1);
+	DashChargeState.LastConsumeTime = Now;
+	SHOOTER_MARK_DIRTY(AShooterCharacter, DashChargeState, this);
 
-	UE_LOG(LogTemp, Warning, TEXT("Dash[Char]: RefillAllTimer fired -> Curr=%d/%d (refilled to max)"),
-		CurrentDashCharges, MaxDashCharges);
+	UE_LOG(LogTemp, Warning, TEXT("Dash[Char]: ConsumeDashCharge OK (%s): Curr=%d/%d"),
+		HasAuthority() ? TEXT("server") : TEXT("client predict"), Charges - 1, MaxDashCharges);
+	return true;
 }
 
-void AShooterCharacter::DashRechargeTick_PerCharge()
+void AShooterCharacter::AddDashChargeLocal(int32 Delta)
 {
-	if (!HasAuthority()) return;
-
-	if (CurrentDashCharges < MaxDashCharges)
-	{
-		++CurrentDashCharges;
-		Rep_CurrentDashCharges = CurrentDashCharges;
-		UE_LOG(LogTemp, Warning, TEXT("Dash[Char]: DashRechargeTick: +1 -> Curr=%d/%d"), CurrentDashCharges, MaxDashCharges);
-	}
-
-	if (CurrentDashCharges >= MaxDashCharges)
-	{
-		GetWorldTimerManager().ClearTimer(DashRechargeTimer);
-	}
+	const int32 Charges = FMath::Clamp(GetCurrentDashCharges() + Delta, 0, MaxDashCharges);
+	DashChargeState.ChargesUsed = (uint8)(MaxDashCharges - Charges);
+	SHOOTER_MARK_DIRTY(AShooterCharacter, DashChargeState, this);
 }
 
 // --- Camera helpers ------------------------------------------------------------------------------
@@ -583,6 +547,7 @@ void AShooterCharacter::SetUseThirdPersonCamera(bool bEnable)
 	if (HasAuthority())
 	{
 		bUseThirdPersonCamera = bEnable;
+		SHOOTER_MARK_DIRTY(AShooterCharacter, bUseThirdPersonCamera, this);
 		ApplyCameraMode();
 	}
 	else
@@ -597,6 +562,7 @@ void AShooterCharacter::SetUseThirdPersonCamera(bool bEnable)
 void AShooterCharacter::ServerSetUseThirdPersonCamera_Implementation(bool bEnable)
 {
 	bUseThirdPersonCamera = bEnable;
+	SHOOTER_MARK_DIRTY(AShooterCharacter, bUseThirdPersonCamera, this);
 	ApplyCameraMode();
 }
 
@@ -747,10 +713,17 @@ void AShooterCharacter::HandleDeath()
 		ASC->ExecuteGameplayCue(ShooterTags::GameplayCue_Damage_Death);
 	}
 
+	// Time dilation is world-wide: skip it when other runs share this world
+	const UShooterRunHostSubsystem* Host = GetWorld()->GetSubsystem<UShooterRunHostSubsystem>();
+	const bool bHostedRun = Host && Host->IsHostingRuns();
+
 	// 7. Slow motion and fade to black
 	if (APlayerController* PC = Cast<APlayerController>(GetController()))
 	{
-		UGameplayStatics::SetGlobalTimeDilation(GetWorld(), 0.3f);
+		if (!bHostedRun)
+		{
+			UGameplayStatics::SetGlobalTimeDilation(GetWorld(), 0.3f);
+		}
 
 		if (PC->PlayerCameraManager)
 		{
@@ -764,9 +737,12 @@ void AShooterCharacter::HandleDeath()
 		FTimerHandle RespawnHandle;
 		GetWorldTimerManager().SetTimer(
 			RespawnHandle,
-			[this]()
+			[this, bHostedRun]()
 			{
-				UGameplayStatics::SetGlobalTimeDilation(GetWorld(), 1.0f);
+				if (!bHostedRun)
+				{
+					UGameplayStatics::SetGlobalTimeDilation(GetWorld(), 1.0f);
+				}
 
 				AController* ControllerRef = GetController();
 				if (!ControllerRef)
@@ -783,23 +759,37 @@ void AShooterCharacter::HandleDeath()
 				}
 
 				AShooterCharacter* OldCharacter = this;
+				APawn* NewPawn = this;
 
-				UE_LOG(LogTemp, Warning, TEXT("HandleDeath: Unpossessing old pawn %s"), *GetName());
-				ControllerRef->UnPossess(); // <-- critical line
+				// Revive this pawn in place; a fresh pawn only when that is disabled or impossible
+				if (!GM->RevivePlayer(ControllerRef))
+				{
+					UE_LOG(LogTemp, Warning, TEXT("HandleDeath: Unpossessing old pawn %s"), *GetName());
+					ControllerRef->UnPossess(); // <-- critical line
 
-				// Now spawn the new pawn cleanly
-				UE_LOG(LogTemp, Warning, TEXT("HandleDeath: Restarting player..."));
-				GM->RestartPlayer(ControllerRef);
+					// Now spawn the new pawn cleanly
+					UE_LOG(LogTemp, Warning, TEXT("HandleDeath: Restarting player..."));
+					GM->RestartPlayer(ControllerRef);
 
-				APawn* NewPawn = ControllerRef->GetPawn();
-				if (!NewPawn)
-				{
-					UE_LOG(LogTemp, Error, TEXT("HandleDeath: Controller has no new pawn after RestartPlayer."));
-					return;
+					NewPawn = ControllerRef->GetPawn();
+					if (!NewPawn)
+					{
+						UE_LOG(LogTemp, Error, TEXT("HandleDeath: Controller has no new pawn after RestartPlayer."));
+						return;
+					}
 				}
 
 				UE_LOG(LogTemp, Warning, TEXT("HandleDeath: Controller now possesses %s"), *GetNameSafe(NewPawn));
 
+				// Hosted runs start over in a fresh arena instance
+				if (UShooterRunHostSubsystem* RunHost = GetWorld()->GetSubsystem<UShooterRunHostSubsystem>())
+				{
+					if (RunHost->IsHostingRuns())
+					{
+						RunHost->RestartRun(ControllerRef);
+					}
+				}
+
 				// Hide and destroy the old pawn
 				if (OldCharacter && OldCharacter != NewPawn)
 				{
@@ -827,6 +817,66 @@ void AShooterCharacter::HandleDeath()
 	}
 }
 
+void AShooterCharacter::ReviveAt(const FTransform& SpawnTransform)
+{
+	if (!HasAuthority())
+	{
+		return;
+	}
+
+	UE_LOG(LogTemp, Warning, TEXT("ReviveAt: Reviving %s in place"), *GetName());
+
+	// Health, effects (augment GEs included), loose tags and running abilities
+	ResetCombatState();
+
+	// A death ends the run's build, as a fresh pawn would
+	if (AugmentManager)
+	{
+		AugmentManager->ClearAugments();
+	}
+
+	DashChargeState = FShooterDashChargeState();
+	SHOOTER_MARK_DIRTY(AShooterCharacter, DashChargeState, this);
+
+	TeleportTo(SpawnTransform.GetLocation(), SpawnTransform.Rotator(), false, true);
+	if (AController* C = GetController())
+	{
+		C->SetControlRotation(SpawnTransform.Rotator());
+	}
+
+	// Clears bIsDead; owning and simulated clients run ResetDeathState from OnRep_Death
+	ResetDeathState();
+	ForceNetUpdate();
+}
+
+void AShooterCharacter::ResetDeathState()
+{
+	Super::ResetDeathState();
+
+	// Undo HandleDeath's input lock and death camera
+	if (AController* C = GetController())
+	{
+		C->ResetIgnoreInputFlags();
+	}
+	EnableInput(nullptr);
+
+	if (HasAuthority())
+	{
+		SetUseThirdPersonCamera(false);
+	}
+
+	if (IsLocallyControlled())
+	{
+		if (APlayerController* PC = Cast<APlayerController>(GetController()))
+		{
+			if (PC->PlayerCameraManager)
+			{
+				PC->PlayerCameraManager->StartCameraFade(1.f, 0.f, 0.8f, FLinearColor::Black, false, false);
+			}
+		}
+	}
+}
+
 AActor* AShooterCharacter::PerformInteractionTrace(float Distance, FHitResult& OutHit)
 {
 	OutHit = FHitResult();
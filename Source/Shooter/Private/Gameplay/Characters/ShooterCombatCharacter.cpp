@@ -3,6 +3,12 @@
 #include "Gameplay/Combat/Weapons/Base/ShooterWeaponBase.h"
 #include "Gameplay/Characters/Player/Movement/ShooterCharacterMovement_Doom.h"
 #include "Gameplay/Tags/ShooterGameplayTags.h"
+#include "Gameplay/Characters/ShooterCorpseSubsystem.h"
+#include "Gameplay/Arena/ShooterArenaCollisionSubsystem.h"
+#include "Gameplay/Combat/ShooterCombatEventSubsystem.h"
+#include "Gameplay/Net/ShooterNetRelevancySubsystem.h"
+#include "Gameplay/Net/ShooterPushModel.h"
+#include "Gameplay/Run/ShooterRunHostSubsystem.h"
 
 #include "Components/CapsuleComponent.h"
 #include "AbilitySystemComponent.h"
@@ -36,6 +42,14 @@ AShooterCombatCharacter::AShooterCombatCharacter(const FObjectInitializer& Objec
 	SetReplicateMovement(true);
 }
 
+void AShooterCombatCharacter::TickActor(float DeltaTime, ELevelTick TickType, FActorTickFunction& ThisTickFunction)
+{
+	// Charged to the hosted run this character fights in (load test tick report)
+	FShooterRunTickScope RunTickScope(this);
+
+	Super::TickActor(DeltaTime, TickType, ThisTickFunction);
+}
+
 void AShooterCombatCharacter::BeginPlay()
 {
 	Super::BeginPlay();
@@ -45,6 +59,32 @@ void AShooterCombatCharacter::BeginPlay()
 		CombatAttributes
 	);
 
+	if (USkeletalMeshComponent* MeshComp = GetMesh())
+	{
+		DefaultMeshRelativeTransform = MeshComp->GetRelativeTransform();
+		DefaultMeshCollisionProfile = MeshComp->GetCollisionProfileName();
+	}
+
+	if (UShooterArenaCollisionSubsystem* ArenaCollision = GetWorld()->GetSubsystem<UShooterArenaCollisionSubsystem>())
+	{
+		ArenaCollision->RegisterCombatant(this);
+	}
+
+	// Fires on the server for every write and on clients for replicated values
+	if (ASC)
+	{
+		ASC->GetGameplayAttributeValueChangeDelegate(UAttrSet_Combat::GetHealthAttribute()).AddUObject(this, &AShooterCombatCharacter::OnHealthAttributeChanged);
+		ASC->GetGameplayAttributeValueChangeDelegate(UAttrSet_Combat::GetMaxHealthAttribute()).AddUObject(this, &AShooterCombatCharacter::OnMaxHealthAttributeChanged);
+	}
+
+	if (HasAuthority())
+	{
+		if (UShooterNetRelevancySubsystem* NetPolicy = GetWorld()->GetSubsystem<UShooterNetRelevancySubsystem>())
+		{
+			NetPolicy->RegisterPawn(this);
+		}
+	}
+
 	if (HasAuthority() && DefaultWeaponClass)
 	{
 		SpawnDefaultWeapon();
@@ -82,16 +122,52 @@ void AShooterCombatCharacter::GrantStartupAbilities()
 	}
 
 	// --- Give Fire ability (shared by AI and Player) ---
-	if (FireWeaponAbilityClass)
+	FireAbilityHandle = GiveStartupAbility(FireWeaponAbilityClass, ShooterTags::Ability_Weapon_Fire);
+	MeleeAbilityHandle = GiveStartupAbility(MeleeAbilityClass, ShooterTags::Ability_Weapon_Melee);
+	DashAbilityHandle = GiveStartupAbility(DashAbilityClass, ShooterTags::Ability_Movement_Dash);
+
+	bStartupAbilitiesGiven = true;
+}
+
+FGameplayAbilitySpecHandle AShooterCombatCharacter::GiveStartupAbility(TSubclassOf<UGameplayAbility> AbilityClass, const FGameplayTag& AbilityTag)
+{
+	if (!ASC || !AbilityClass)
 	{
-		FGameplayAbilitySpec Spec(FireWeaponAbilityClass, 1, INDEX_NONE, this);
-		Spec.GetDynamicSpecSourceTags().AddTag(ShooterTags::Ability_Weapon_Fire);
-		ASC->GiveAbility(Spec);
+		return FGameplayAbilitySpecHandle();
+	}
 
-		UE_LOG(LogTemp, Warning, TEXT("[ASC] Granted FireWeaponAbility to %s"), *GetName());
+	// Reuse an existing spec (e.g. granted before a re-possess) instead of stacking duplicates
+	if (const FGameplayAbilitySpec* Existing = ASC->FindAbilitySpecFromClass(AbilityClass))
+	{
+		return Existing->Handle;
 	}
 
-	bStartupAbilitiesGiven = true;
+	FGameplayAbilitySpec Spec(AbilityClass, 1, INDEX_NONE, this);
+	Spec.GetDynamicSpecSourceTags().AddTag(AbilityTag);
+
+	UE_LOG(LogTemp, Warning, TEXT("[ASC] Granted %s to %s"), *GetNameSafe(AbilityClass), *GetName());
+
+	return ASC->GiveAbility(Spec);
+}
+
+bool AShooterCombatCharacter::TryActivateAbilityHandle(const FGameplayAbilitySpecHandle& Handle)
+{
+	return ASC && Handle.IsValid() && ASC->TryActivateAbility(Handle);
+}
+
+bool AShooterCombatCharacter::TryActivateFireAbility()
+{
+	return TryActivateAbilityHandle(FireAbilityHandle);
+}
+
+bool AShooterCombatCharacter::TryActivateMeleeAbility()
+{
+	return TryActivateAbilityHandle(MeleeAbilityHandle.IsValid() ? MeleeAbilityHandle : FireAbilityHandle);
+}
+
+bool AShooterCombatCharacter::TryActivateDashAbility()
+{
+	return TryActivateAbilityHandle(DashAbilityHandle);
 }
 
 UAbilitySystemComponent* AShooterCombatCharacter::GetAbilitySystemComponent() const
@@ -118,27 +194,61 @@ void AShooterCombatCharacter::OnOutOfHealth()
 {
 	if (bIsDead) return;
 	bIsDead = true;
+	SHOOTER_MARK_DIRTY(AShooterCombatCharacter, bIsDead, this);
 
-	if (ASC)
+	UE_LOG(LogTemp, Warning, TEXT("%s has died."), *GetName());
+
+	// Cue, input, movement and collision are handled by HandleDeath
+	HandleDeath();
+}
+
+void AShooterCombatCharacter::HandleHealthChanged(float NewHealth, float MaxHealth)
+{
+	if (HasAuthority() && NewHealth <= 0.f && !bIsDead)
 	{
-		const FGameplayTag DeathCue = FGameplayTag::RequestGameplayTag(FName("GameplayCue.Damage.Death"));
-		ASC->ExecuteGameplayCue(DeathCue);
+		OnOutOfHealth();
 	}
+}
 
-	DisableInput(nullptr);
-	GetCharacterMovement()->DisableMovement();
-	GetCapsuleComponent()->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+void AShooterCombatCharacter::OnHealthAttributeChanged(const FOnAttributeChangeData& Data)
+{
+	const float MaxHealth = GetMaxHealth();
+	const float OldHealth = FMath::Clamp(Data.OldValue, 0.f, MaxHealth);
+	const float NewHealth = FMath::Clamp(Data.NewValue, 0.f, MaxHealth);
 
-	HandleDeath();
+	// e.g. the clamp in PostGameplayEffectExecute after an overkill hit
+	if (OldHealth == NewHealth)
+	{
+		return;
+	}
+
+	AActor* EffectInstigator = Data.GEModData ? Data.GEModData->EffectSpec.GetContext().GetOriginalInstigator() : nullptr;
+	PublishHealthChanged(OldHealth, NewHealth, MaxHealth, EffectInstigator);
+
+	HandleHealthChanged(NewHealth, MaxHealth);
 }
 
-void AShooterCombatCharacter::HandleHealthChanged(float NewHealth, float MaxHealth)
+void AShooterCombatCharacter::OnMaxHealthAttributeChanged(const FOnAttributeChangeData& Data)
+{
+	const float Health = FMath::Clamp(GetHealth(), 0.f, Data.NewValue);
+	PublishHealthChanged(Health, Health, Data.NewValue, nullptr);
+}
+
+void AShooterCombatCharacter::PublishHealthChanged(float OldHealth, float NewHealth, float MaxHealth, AActor* EffectInstigator)
 {
-	if (NewHealth <= 0.f && !bIsDead)
+	UShooterCombatEventSubsystem* Events = GetWorld() ? GetWorld()->GetSubsystem<UShooterCombatEventSubsystem>() : nullptr;
+	if (!Events)
 	{
-		bIsDead = true;
-		HandleDeath();
+		return;
 	}
+
+	FShooterHealthEvent Event;
+	Event.Character = this;
+	Event.Instigator = EffectInstigator;
+	Event.OldHealth = OldHealth;
+	Event.NewHealth = NewHealth;
+	Event.MaxHealth = MaxHealth;
+	Events->PublishHealthChanged(Event);
 }
 
 void AShooterCombatCharacter::HandleDeath()
@@ -157,17 +267,24 @@ void AShooterCombatCharacter::HandleDeath()
 		ASC->CancelAllAbilities();
 	}
 
-	if (USkeletalMeshComponent* MeshComp = GetMesh())
+	if (UCapsuleComponent* Capsule = GetCapsuleComponent())
 	{
-		MeshComp->SetCollisionProfileName(TEXT("Ragdoll"));
-		MeshComp->SetSimulatePhysics(true);
-		MeshComp->WakeAllRigidBodies();
-		MeshComp->bBlendPhysics = true;
+		Capsule->SetCollisionEnabled(ECollisionEnabled::NoCollision);
 	}
 
-	if (UCapsuleComponent* Capsule = GetCapsuleComponent())
+	if (UShooterArenaCollisionSubsystem* ArenaCollision = GetWorld()->GetSubsystem<UShooterArenaCollisionSubsystem>())
 	{
-		Capsule->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+		ArenaCollision->UnregisterCombatant(this);
+	}
+
+	// Ragdolls are budgeted by the corpse subsystem, which does not exist on dedicated servers
+	if (UShooterCorpseSubsystem* Corpses = GetWorld()->GetSubsystem<UShooterCorpseSubsystem>())
+	{
+		Corpses->RegisterCorpse(this);
+	}
+	else if (USkeletalMeshComponent* MeshComp = GetMesh())
+	{
+		MeshComp->SetCollisionEnabled(ECollisionEnabled::NoCollision);
 	}
 
 	if (ASC)
@@ -176,17 +293,23 @@ void AShooterCombatCharacter::HandleDeath()
 		ASC->ExecuteGameplayCue(DeathCue);
 	}
 
-	const float CorpseLifetime = 8.0f;
-	FTimerHandle CleanupHandle;
-	GetWorldTimerManager().SetTimer(
-		CleanupHandle,
-		[this]()
-		{
-			Destroy();
-		},
-		CorpseLifetime,
-		false
-	);
+	if (HasAuthority())
+	{
+		OnDied.Broadcast(this);
+
+		GetWorldTimerManager().SetTimer(
+			CorpseTimerHandle,
+			this,
+			&AShooterCombatCharacter::OnCorpseExpired,
+			CorpseLifetime,
+			false
+		);
+	}
+}
+
+void AShooterCombatCharacter::OnCorpseExpired()
+{
+	Destroy();
 }
 
 void AShooterCombatCharacter::OnRep_Death()
@@ -195,6 +318,116 @@ void AShooterCombatCharacter::OnRep_Death()
 	{
 		HandleDeath();
 	}
+	else
+	{
+		ResetDeathState();
+	}
+}
+
+void AShooterCombatCharacter::StartRagdoll()
+{
+	if (USkeletalMeshComponent* MeshComp = GetMesh())
+	{
+		MeshComp->SetCollisionProfileName(TEXT("Ragdoll"));
+		MeshComp->SetSimulatePhysics(true);
+		MeshComp->WakeAllRigidBodies();
+		MeshComp->bBlendPhysics = true;
+	}
+}
+
+void AShooterCombatCharacter::FreezeRagdoll()
+{
+	if (USkeletalMeshComponent* MeshComp = GetMesh())
+	{
+		MeshComp->SetSimulatePhysics(false);
+		MeshComp->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+		MeshComp->bNoSkeletonUpdate = true;
+		MeshComp->SetComponentTickEnabled(false);
+	}
+}
+
+void AShooterCombatCharacter::FinishCorpse()
+{
+	// Visual only: expiry (pool release / destroy) stays on CorpseTimerHandle, so a listen server's
+	// local corpse budget never recycles an enemy earlier than a dedicated server would
+	if (USkeletalMeshComponent* MeshComp = GetMesh())
+	{
+		MeshComp->SetVisibility(false, true);
+	}
+}
+
+void AShooterCombatCharacter::ResetDeathState()
+{
+	bIsDead = false;
+	SHOOTER_MARK_DIRTY(AShooterCombatCharacter, bIsDead, this);
+	GetWorldTimerManager().ClearTimer(CorpseTimerHandle);
+
+	if (UShooterCorpseSubsystem* Corpses = GetWorld() ? GetWorld()->GetSubsystem<UShooterCorpseSubsystem>() : nullptr)
+	{
+		Corpses->UnregisterCorpse(this);
+	}
+
+	if (USkeletalMeshComponent* MeshComp = GetMesh())
+	{
+		MeshComp->bNoSkeletonUpdate = false;
+		MeshComp->SetComponentTickEnabled(true);
+		MeshComp->SetVisibility(true, true);
+		MeshComp->SetSimulatePhysics(false);
+		MeshComp->bBlendPhysics = false;
+		MeshComp->AttachToComponent(GetCapsuleComponent(), FAttachmentTransformRules::KeepRelativeTransform);
+		MeshComp->SetRelativeTransform(DefaultMeshRelativeTransform);
+		MeshComp->SetCollisionProfileName(DefaultMeshCollisionProfile);
+	}
+
+	if (UCapsuleComponent* Capsule = GetCapsuleComponent())
+	{
+		Capsule->SetCollisionEnabled(ECollisionEnabled::QueryAndPhysics);
+	}
+
+	if (UCharacterMovementComponent* MoveComp = GetCharacterMovement())
+	{
+		MoveComp->StopMovementImmediately();
+		MoveComp->SetMovementMode(MOVE_Walking);
+	}
+
+	// Restoring the mesh profile reset its channel responses
+	if (UShooterArenaCollisionSubsystem* ArenaCollision = GetWorld() ? GetWorld()->GetSubsystem<UShooterArenaCollisionSubsystem>() : nullptr)
+	{
+		ArenaCollision->RegisterCombatant(this);
+	}
+}
+
+void AShooterCombatCharacter::ResetCombatState()
+{
+	if (!HasAuthority() || !ASC)
+	{
+		return;
+	}
+
+	ASC->CancelAllAbilities();
+
+	// Match every active effect (buffs, DoTs, i-frames) and strip it
+	FGameplayEffectQuery AllEffects;
+	AllEffects.CustomMatchDelegate.BindLambda([](const FActiveGameplayEffect&) { return true; });
+	ASC->RemoveActiveEffects(AllEffects);
+
+	FGameplayTagContainer OwnedTags;
+	ASC->GetOwnedGameplayTags(OwnedTags);
+	for (const FGameplayTag& Tag : OwnedTags)
+	{
+		ASC->SetLooseGameplayTagCount(Tag, 0);
+	}
+
+	if (CombatAttributes)
+	{
+		ASC->SetNumericAttributeBase(UAttrSet_Combat::GetHealthAttribute(), CombatAttributes->GetMaxHealth());
+		ASC->SetNumericAttributeBase(UAttrSet_Combat::GetStaminaAttribute(), CombatAttributes->GetMaxStamina());
+	}
+
+	if (EquippedWeapon)
+	{
+		EquippedWeapon->ResetWeaponState();
+	}
 }
 
 void AShooterCombatCharacter::SpawnDefaultWeapon()
@@ -257,5 +490,8 @@ void AShooterCombatCharacter::SpawnDefaultWeapon_Internal()
 void AShooterCombatCharacter::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
 {
 	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
-	DOREPLIFETIME(AShooterCombatCharacter, bIsDead);
+
+	FDoRepLifetimeParams Params;
+	Params.bIsPushBased = true;
+	DOREPLIFETIME_WITH_PARAMS_FAST(AShooterCombatCharacter, bIsDead, Params);
 }
@@ -0,0 +1,231 @@
+#include "Gameplay/Characters/ShooterCorpseSubsystem.h"
+#include "Gameplay/Characters/ShooterCombatCharacter.h"
+
+#include "Components/SkeletalMeshComponent.h"
+#include "Engine/World.h"
+
+static TAutoConsoleVariable<int32> CVarCorpseMaxSimulated(
+    TEXT("colosseum.Corpse.MaxSimulated"),
+    8,
+    TEXT("Maximum ragdolls simulating at once. The oldest is frozen when a new one starts."),
+    ECVF_Cheat);
+
+static TAutoConsoleVariable<int32> CVarCorpseMaxStartsPerFrame(
+    TEXT("colosseum.Corpse.MaxStartsPerFrame"),
+    3,
+    TEXT("Ragdolls woken per frame; further deaths wait for the next frame."),
+    ECVF_Cheat);
+
+static TAutoConsoleVariable<int32> CVarCorpseMaxCorpses(
+    TEXT("colosseum.Corpse.MaxCorpses"),
+    24,
+    TEXT("Corpses kept before the oldest are faded out and hidden."),
+    ECVF_Cheat);
+
+static TAutoConsoleVariable<float> CVarCorpseSettleSpeed(
+    TEXT("colosseum.Corpse.SettleSpeed"),
+    15.f,
+    TEXT("Root body speed (cm/s) below which a ragdoll counts as settled."),
+    ECVF_Cheat);
+
+static TAutoConsoleVariable<float> CVarCorpseSettleTime(
+    TEXT("colosseum.Corpse.SettleTime"),
+    0.5f,
+    TEXT("Seconds a ragdoll must stay settled before it is frozen."),
+    ECVF_Cheat);
+
+static TAutoConsoleVariable<float> CVarCorpseMaxSimTime(
+    TEXT("colosseum.Corpse.MaxSimTime"),
+    4.f,
+    TEXT("Ragdolls are frozen after simulating this long, settled or not."),
+    ECVF_Cheat);
+
+static TAutoConsoleVariable<float> CVarCorpseFadeTime(
+    TEXT("colosseum.Corpse.FadeTime"),
+    1.f,
+    TEXT("Seconds between OnCorpseFade and hiding an over-budget corpse."),
+    ECVF_Cheat);
+
+bool UShooterCorpseSubsystem::ShouldCreateSubsystem(UObject* Outer) const
+{
+    // Ragdolls are purely cosmetic; dedicated servers skip them entirely
+    return !IsRunningDedicatedServer() && Super::ShouldCreateSubsystem(Outer);
+}
+
+void UShooterCorpseSubsystem::Deinitialize()
+{
+    Corpses.Empty();
+
+    Super::Deinitialize();
+}
+
+TStatId UShooterCorpseSubsystem::GetStatId() const
+{
+    RETURN_QUICK_DECLARE_CYCLE_STAT(UShooterCorpseSubsystem, STATGROUP_Tickables);
+}
+
+void UShooterCorpseSubsystem::RegisterCorpse(AShooterCombatCharacter* Character)
+{
+    if (!Character)
+    {
+        return;
+    }
+
+    UnregisterCorpse(Character);
+
+    FShooterCorpse& Corpse = Corpses.AddDefaulted_GetRef();
+    Corpse.Character = Character;
+}
+
+void UShooterCorpseSubsystem::UnregisterCorpse(AShooterCombatCharacter* Character)
+{
+    // Keep oldest-first ordering
+    Corpses.RemoveAll([Character](const FShooterCorpse& Corpse) { return Corpse.Character.Get() == Character; });
+}
+
+int32 UShooterCorpseSubsystem::GetNumSimulating() const
+{
+    int32 Num = 0;
+    for (const FShooterCorpse& Corpse : Corpses)
+    {
+        Num += Corpse.State == EShooterCorpseState::Simulating ? 1 : 0;
+    }
+    return Num;
+}
+
+void UShooterCorpseSubsystem::FreezeCorpse(FShooterCorpse& Corpse)
+{
+    if (AShooterCombatCharacter* Character = Corpse.Character.Get())
+    {
+        Character->FreezeRagdoll();
+    }
+    Corpse.State = EShooterCorpseState::Frozen;
+}
+
+void UShooterCorpseSubsystem::BeginFade(FShooterCorpse& Corpse)
+{
+    if (Corpse.State == EShooterCorpseState::Simulating || Corpse.State == EShooterCorpseState::PendingRagdoll)
+    {
+        FreezeCorpse(Corpse);
+    }
+
+    Corpse.State = EShooterCorpseState::Fading;
+    Corpse.FadeRemaining = CVarCorpseFadeTime.GetValueOnGameThread();
+
+    if (AShooterCombatCharacter* Character = Corpse.Character.Get())
+    {
+        Character->OnCorpseFade(Corpse.FadeRemaining);
+    }
+}
+
+void UShooterCorpseSubsystem::Tick(float DeltaTime)
+{
+    Corpses.RemoveAll([](const FShooterCorpse& Corpse) { return !Corpse.Character.IsValid(); });
+
+    if (Corpses.Num() == 0)
+    {
+        return;
+    }
+
+    const int32 MaxSimulated = FMath::Max(0, CVarCorpseMaxSimulated.GetValueOnGameThread());
+    const int32 MaxCorpses = FMath::Max(1, CVarCorpseMaxCorpses.GetValueOnGameThread());
+    const float SettleSpeedSq = FMath::Square(CVarCorpseSettleSpeed.GetValueOnGameThread());
+    const float SettleTime = CVarCorpseSettleTime.GetValueOnGameThread();
+    const float MaxSimTime = CVarCorpseMaxSimTime.GetValueOnGameThread();
+
+    int32 NumSimulating = 0;
+    int32 NumAlive = 0;
+    TArray<AShooterCombatCharacter*> ToFinish;
+
+    // Oldest first: settle checks, fades, and the over-budget count
+    for (FShooterCorpse& Corpse : Corpses)
+    {
+        AShooterCombatCharacter* Character = Corpse.Character.Get();
+
+        switch (Corpse.State)
+        {
+        case EShooterCorpseState::Simulating:
+        {
+            Corpse.SimulatedTime += DeltaTime;
+
+            const USkeletalMeshComponent* Mesh = Character->GetMesh();
+            const bool bSlow = !Mesh || Mesh->GetPhysicsLinearVelocity().SizeSquared() < SettleSpeedSq;
+            Corpse.SettledTime = bSlow ? Corpse.SettledTime + DeltaTime : 0.f;
+
+            if (Corpse.SettledTime >= SettleTime || Corpse.SimulatedTime >= MaxSimTime)
+            {
+                FreezeCorpse(Corpse);
+            }
+            else
+            {
+                ++NumSimulating;
+            }
+            break;
+        }
+        case EShooterCorpseState::Fading:
+            Corpse.FadeRemaining -= DeltaTime;
+            if (Corpse.FadeRemaining <= 0.f)
+            {
+                ToFinish.Add(Character);
+            }
+            continue;
+
+        default:
+            break;
+        }
+
+        ++NumAlive;
+    }
+
+    // Fade out the oldest corpses beyond the cap
+    for (int32 i = 0; i < Corpses.Num() && NumAlive > MaxCorpses; ++i)
+    {
+        if (Corpses[i].State != EShooterCorpseState::Fading)
+        {
+            if (Corpses[i].State == EShooterCorpseState::Simulating)
+            {
+                --NumSimulating;
+            }
+            BeginFade(Corpses[i]);
+            --NumAlive;
+        }
+    }
+
+    // Wake pending ragdolls, newest deaths first; freeze the oldest simulating one to stay in budget
+    int32 StartsLeft = FMath::Max(1, CVarCorpseMaxStartsPerFrame.GetValueOnGameThread());
+    for (int32 i = Corpses.Num() - 1; i >= 0 && StartsLeft > 0; --i)
+    {
+        FShooterCorpse& Corpse = Corpses[i];
+        if (Corpse.State != EShooterCorpseState::PendingRagdoll)
+        {
+            continue;
+        }
+
+        if (MaxSimulated == 0)
+        {
+            FreezeCorpse(Corpse);
+            continue;
+        }
+
+        for (int32 j = 0; j < Corpses.Num() && NumSimulating >= MaxSimulated; ++j)
+        {
+            if (Corpses[j].State == EShooterCorpseState::Simulating)
+            {
+                FreezeCorpse(Corpses[j]);
+                --NumSimulating;
+            }
+        }
+
+        Corpse.Character->StartRagdoll();
+        Corpse.State = EShooterCorpseState::Simulating;
+        ++NumSimulating;
+        --StartsLeft;
+    }
+
+    // Last, after the loop over Corpses
+    for (AShooterCombatCharacter* Character : ToFinish)
+    {
+        UnregisterCorpse(Character);
+        Character->FinishCorpse();
+    }
+}
@@ -1,19 +1,36 @@
 #include "Gameplay/Combat/Projectile/ShooterProjectile.h"
+#include "Gameplay/AI/Crowd/ShooterCrowdSubsystem.h"
+#include "Gameplay/Arena/ShooterArenaCollisionSubsystem.h"
+#include "Gameplay/Net/ShooterPushModel.h"
 
 #include "Components/SphereComponent.h"
+#include "GameFramework/GameStateBase.h"
 #include "NiagaraComponent.h"
 #include "NiagaraSystem.h"
 #include "Net/UnrealNetwork.h"
 #include "Kismet/GameplayStatics.h"
 #include "NiagaraFunctionLibrary.h"
 
+// Shared clock for the replicated launch stamp
+static double GetServerTimeSeconds(const UWorld* World)
+{
+    const AGameStateBase* GameState = World ? World->GetGameState() : nullptr;
+    return GameState ? GameState->GetServerWorldTimeSeconds() : (World ? World->GetTimeSeconds() : 0.0);
+}
+
 AShooterProjectile::AShooterProjectile()
 {
     PrimaryActorTick.bCanEverTick = true;
     bReplicates = true;
-    bAlwaysRelevant = false; // You can tweak relevancy later.
+    bAlwaysRelevant = false;
     SetNetUpdateFrequency(60.0f);
 
+    // Spatial relevancy: only connections within tracer range receive a projectile
+    SetNetCullDistanceSquared(FMath::Square(6000.f));
+
+    // Pooled projectiles sit dormant until fired
+    NetDormancy = DORM_DormantAll;
+
     CollisionComponent = CreateDefaultSubobject<USphereComponent>(TEXT("Collision"));
     SetRootComponent(CollisionComponent);
     CollisionComponent->InitSphereRadius(2.0f);
@@ -29,7 +46,6 @@ AShooterProjectile::AShooterProjectile()
 
     Velocity = FVector::ZeroVector;
     ElapsedLifeTime = 0.0f;
-    bIsActive = false;
 
     SetActorEnableCollision(false);
     SetActorHiddenInGame(true);
@@ -44,10 +60,20 @@ void AShooterProjectile::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& O
 {
     Super::GetLifetimeReplicatedProps(OutLifetimeProps);
 
-    DOREPLIFETIME(AShooterProjectile, Velocity);
-    DOREPLIFETIME(AShooterProjectile, StartLocation);
-    DOREPLIFETIME(AShooterProjectile, ElapsedLifeTime);
-    DOREPLIFETIME(AShooterProjectile, bIsActive);
+    FDoRepLifetimeParams Params;
+    Params.bIsPushBased = true;
+
+    DOREPLIFETIME_WITH_PARAMS_FAST(AShooterProjectile, RepState, Params);
+}
+
+float AShooterProjectile::GetFlightTime() const
+{
+    if (HasAuthority())
+    {
+        return ElapsedLifeTime;
+    }
+
+    return RepState.bIsActive ? RepState.GetFlightTime(GetServerTimeSeconds(GetWorld())) : 0.0f;
 }
 
 void AShooterProjectile::InitializeFromConfig(const FProjectileConfig& InConfig)
@@ -66,13 +92,23 @@ void AShooterProjectile::InitializeFromConfig(const FProjectileConfig& InConfig)
 
 void AShooterProjectile::OnPooledActivate(const FVector& SpawnLocation, const FVector& Direction, AController* InstigatorController, AActor* InstigatorActor)
 {
-    bIsActive = true;
+    if (HasAuthority())
+    {
+        SetNetDormancy(DORM_Awake);
+    }
+
     ElapsedLifeTime = 0.0f;
-    StartLocation = SpawnLocation;
 
     SetActorLocation(SpawnLocation);
     Velocity = Direction.GetSafeNormal() * Config.InitialSpeed;
 
+    RepState.bIsActive = true;
+    RepState.StartLocation = SpawnLocation;
+    RepState.LaunchVelocity = Velocity;
+    RepState.LaunchTimeMs = FShooterProjectileRepState::PackTimeMs(GetServerTimeSeconds(GetWorld()));
+    RepState.GravityScale = Config.GravityScale;
+    SHOOTER_MARK_DIRTY(AShooterProjectile, RepState, this);
+
     InstigatorControllerWeak = InstigatorController;
     InstigatorActorWeak = InstigatorActor;
 
@@ -87,7 +123,9 @@ void AShooterProjectile::OnPooledActivate(const FVector& SpawnLocation, const FV
 
 void AShooterProjectile::OnPooledDeactivate()
 {
-    bIsActive = false;
+    RepState = FShooterProjectileRepState();
+    SHOOTER_MARK_DIRTY(AShooterProjectile, RepState, this);
+
     SetActorHiddenInGame(true);
     SetActorEnableCollision(false);
 
@@ -98,19 +136,33 @@ void AShooterProjectile::OnPooledDeactivate()
 
     Velocity = FVector::ZeroVector;
     ElapsedLifeTime = 0.0f;
+
+    // Goes dormant once the inactive state has been sent
+    if (HasAuthority())
+    {
+        SetNetDormancy(DORM_DormantAll);
+    }
 }
 
 void AShooterProjectile::Tick(float DeltaSeconds)
 {
     Super::Tick(DeltaSeconds);
 
-    if (!bIsActive || !HasAuthority())
+    if (!RepState.bIsActive)
+    {
+        return;
+    }
+
+    if (!HasAuthority())
     {
-        // Server drives movement; clients receive replicated transforms.
+        // Clients integrate the launch snapshot; only hits and deactivation come from the server
+        SimulateFromRepState();
+        UpdateTracerFX();
         return;
     }
 
     ElapsedLifeTime += DeltaSeconds;
+
     if (ElapsedLifeTime >= Config.MaxLifeTime)
     {
         OnPooledDeactivate();
@@ -130,6 +182,12 @@ void AShooterProjectile::Tick(float DeltaSeconds)
     FHitResult HitResult;
     bool bHit = false;
 
+    // Only arena proxies and combatants while flying inside an arena
+    const UShooterArenaCollisionSubsystem* ArenaCollision = GetWorld()->GetSubsystem<UShooterArenaCollisionSubsystem>();
+    const ECollisionChannel TraceChannel = ArenaCollision
+        ? ArenaCollision->GetCombatTraceChannel(CurrentLocation, Config.CollisionChannel)
+        : Config.CollisionChannel.GetValue();
+
     if (Config.bUseSphereTrace)
     {
         bHit = GetWorld()->SweepSingleByChannel(
@@ -137,7 +195,7 @@ void AShooterProjectile::Tick(float DeltaSeconds)
             CurrentLocation,
             TargetLocation,
             FQuat::Identity,
-            Config.CollisionChannel,
+            TraceChannel,
             FCollisionShape::MakeSphere(Config.Radius),
             FCollisionQueryParams(TEXT("ProjectileTrace"), true, InstigatorActorWeak.Get())
         );
@@ -148,7 +206,7 @@ void AShooterProjectile::Tick(float DeltaSeconds)
             HitResult,
             CurrentLocation,
             TargetLocation,
-            Config.CollisionChannel,
+            TraceChannel,
             FCollisionQueryParams(TEXT("ProjectileTrace"), true, InstigatorActorWeak.Get())
         );
     }
@@ -166,6 +224,34 @@ void AShooterProjectile::Tick(float DeltaSeconds)
     UpdateTracerFX();
 }
 
+void AShooterProjectile::OnRep_RepState()
+{
+    if (!RepState.bIsActive)
+    {
+        SetActorHiddenInGame(true);
+        if (TracerComponent)
+        {
+            TracerComponent->Deactivate();
+        }
+        return;
+    }
+
+    // Start at the launch point so the tracer draws from the muzzle, then catch up with the server's flight time
+    SetActorLocation(RepState.StartLocation);
+    SimulateFromRepState();
+    SetActorHiddenInGame(false);
+
+    if (Config.bSpawnTracerFX && TracerComponent)
+    {
+        TracerComponent->Activate(true);
+    }
+}
+
+void AShooterProjectile::SimulateFromRepState()
+{
+    SetActorLocation(RepState.GetLocationAt(GetFlightTime(), GetWorld()->GetGravityZ()));
+}
+
 void AShooterProjectile::OnProjectileHit(const FHitResult& Hit)
 {
     if (!HasAuthority())
@@ -192,6 +278,12 @@ void AShooterProjectile::ApplyDamage(const FHitResult& Hit)
 
     if (Config.Damage > 0.0f)
     {
+        UShooterCrowdSubsystem* Crowd = GetWorld()->GetSubsystem<UShooterCrowdSubsystem>();
+        if (Crowd && Crowd->ApplyHitDamage(Hit, Config.Damage))
+        {
+            return;
+        }
+
         TSubclassOf<UDamageType> DamageClass = Config.DamageTypeClass;
         if (!DamageClass)
         {
@@ -0,0 +1,171 @@
+#include "Gameplay/Combat/Projectile/ShooterProjectileRepState.h"
+
+#include "Engine/NetSerialization.h"
+#include "HAL/IConsoleManager.h"
+#include "Math/RandomStream.h"
+#include "UObject/CoreNet.h"
+
+uint16 FShooterProjectileRepState::PackTimeMs(double ServerSeconds)
+{
+    return (uint16)(FMath::FloorToInt64(ServerSeconds * 1000.0) & 0xFFFF);
+}
+
+float FShooterProjectileRepState::GetFlightTime(double ServerSeconds) const
+{
+    // Unsigned wrap-around keeps this correct across the 16-bit rollover
+    return (uint16)(PackTimeMs(ServerSeconds) - LaunchTimeMs) / 1000.f;
+}
+
+FVector FShooterProjectileRepState::GetLocationAt(float FlightTime, float WorldGravityZ) const
+{
+    // Closed form of the server's per-tick integration (which runs ahead by g t dt / 2): p = p0 + v0 t + g t^2 / 2
+    return StartLocation
+        + LaunchVelocity * FlightTime
+        + FVector(0.f, 0.f, 0.5f * WorldGravityZ * GravityScale * FMath::Square(FlightTime));
+}
+
+bool FShooterProjectileRepState::NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess)
+{
+    uint8 bActiveBit = bIsActive ? 1 : 0;
+    Ar.SerializeBits(&bActiveBit, 1);
+    bIsActive = bActiveBit != 0;
+
+    if (!bIsActive)
+    {
+        if (Ar.IsLoading())
+        {
+            *this = FShooterProjectileRepState();
+        }
+
+        bOutSuccess = true;
+        return true;
+    }
+
+    bOutSuccess = SerializePackedVector<10, 24>(StartLocation, Ar);
+
+    uint16 Yaw = 0;
+    uint16 Pitch = 0;
+    uint32 Speed = 0;
+    if (Ar.IsSaving())
+    {
+        const FRotator Direction = LaunchVelocity.Rotation();
+        Yaw = FRotator::CompressAxisToShort(Direction.Yaw);
+        Pitch = FRotator::CompressAxisToShort(Direction.Pitch);
+        Speed = (uint32)FMath::RoundToInt(LaunchVelocity.Size());
+    }
+
+    Ar << Yaw;
+    Ar << Pitch;
+    Ar.SerializeIntPacked(Speed);
+    Ar << LaunchTimeMs;
+
+    uint8 bGravityBit = GravityScale != 0.f ? 1 : 0;
+    Ar.SerializeBits(&bGravityBit, 1);
+    if (bGravityBit)
+    {
+        Ar << GravityScale;
+    }
+    else if (Ar.IsLoading())
+    {
+        GravityScale = 0.f;
+    }
+
+    if (Ar.IsLoading())
+    {
+        const FRotator Direction(FRotator::DecompressAxisFromShort(Pitch), FRotator::DecompressAxisFromShort(Yaw), 0.f);
+        LaunchVelocity = Direction.Vector() * (float)Speed;
+    }
+
+    bOutSuccess &= !Ar.IsError();
+    return true;
+}
+
+// --- Bytes harness ---
+
+static FAutoConsoleCommandWithArgs CmdNetProjectileBytes(
+    TEXT("colosseum.Net.ProjectileBytes"),
+    TEXT("colosseum.Net.ProjectileBytes <Samples=1000> <FlightSeconds=1> <NetHz=60>: compares the old per-property projectile encoding with FShooterProjectileRepState over random launches and logs bits per projectile and quantization error."),
+    FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args)
+    {
+        const int32 Samples = FMath::Max(Args.Num() > 0 ? FCString::Atoi(*Args[0]) : 1000, 1);
+        const float FlightSeconds = Args.Num() > 1 ? FCString::Atof(*Args[1]) : 1.f;
+        const float NetHz = Args.Num() > 2 ? FCString::Atof(*Args[2]) : 60.f;
+
+        // Net updates after the launch one that the old layout filled with ElapsedLifeTime (+ Velocity under gravity)
+        const int32 FlightUpdates = FMath::Max(FMath::FloorToInt(FlightSeconds * NetHz) - 1, 0);
+
+        FRandomStream Stream(0x5EED);
+        int64 OldLaunchBits = 0;
+        int64 OldVelocityBits = 0;
+        int64 NewLaunchBits = 0;
+        double MaxLocationError = 0.0;
+        double MaxSpeedError = 0.0;
+        double MaxAngleErrorDeg = 0.0;
+        bool bAllDecoded = true;
+
+        for (int32 i = 0; i < Samples; ++i)
+        {
+            FShooterProjectileRepState State;
+            State.bIsActive = true;
+            State.StartLocation = FVector(Stream.FRandRange(-50000.f, 50000.f), Stream.FRandRange(-50000.f, 50000.f), Stream.FRandRange(-2000.f, 5000.f));
+            State.LaunchVelocity = Stream.VRand() * Stream.FRandRange(3000.f, 90000.f);
+            State.LaunchTimeMs = FShooterProjectileRepState::PackTimeMs(Stream.FRandRange(0.f, 3600.f));
+
+            // Old layout: FVector_NetQuantize Velocity, FVector_NetQuantize10 StartLocation, float ElapsedLifeTime, bool bIsActive
+            {
+                bool bOk = true;
+                FNetBitWriter Writer(nullptr, 512);
+                FVector_NetQuantize Velocity(State.LaunchVelocity);
+                Velocity.NetSerialize(Writer, nullptr, bOk);
+                OldVelocityBits += Writer.GetNumBits();
+
+                FVector_NetQuantize10 StartLocation(State.StartLocation);
+                StartLocation.NetSerialize(Writer, nullptr, bOk);
+                float ElapsedLifeTime = 0.f;
+                Writer << ElapsedLifeTime;
+                Writer.WriteBit(1);
+                OldLaunchBits += Writer.GetNumBits();
+            }
+
+            FNetBitWriter Writer(nullptr, 512);
+            bool bOk = true;
+            State.NetSerialize(Writer, nullptr, bOk);
+            NewLaunchBits += Writer.GetNumBits();
+
+            FNetBitReader Reader(nullptr, Writer.GetData(), Writer.GetNumBits());
+            FShooterProjectileRepState Decoded;
+            bool bReadOk = true;
+            Decoded.NetSerialize(Reader, nullptr, bReadOk);
+            bAllDecoded &= bOk && bReadOk && Decoded.bIsActive && Decoded.LaunchTimeMs == State.LaunchTimeMs;
+
+            MaxLocationError = FMath::Max(MaxLocationError, FVector::Dist(Decoded.StartLocation, State.StartLocation));
+            MaxSpeedError = FMath::Max(MaxSpeedError, FMath::Abs(Decoded.LaunchVelocity.Size() - State.LaunchVelocity.Size()));
+            const double CosAngle = FVector::DotProduct(Decoded.LaunchVelocity.GetSafeNormal(), State.LaunchVelocity.GetSafeNormal());
+            MaxAngleErrorDeg = FMath::Max(MaxAngleErrorDeg, FMath::RadiansToDegrees(FMath::Acos(FMath::Clamp(CosAngle, -1.0, 1.0))));
+        }
+
+        const double OldLaunch = (double)OldLaunchBits / Samples;
+        const double OldVelocity = (double)OldVelocityBits / Samples;
+        const double NewLaunch = (double)NewLaunchBits / Samples;
+
+        // Deactivation: old layout resent zero Velocity, ElapsedLifeTime and the flag; new sends the flag
+        FNetBitWriter ZeroWriter(nullptr, 64);
+        bool bOk = true;
+        FVector_NetQuantize ZeroVelocity(FVector::ZeroVector);
+        ZeroVelocity.NetSerialize(ZeroWriter, nullptr, bOk);
+        const double OldDeactivate = ZeroWriter.GetNumBits() + 32 + 1;
+        const double NewDeactivate = 1;
+
+        const double OldFlightNoGravity = OldLaunch + FlightUpdates * 32.0 + OldDeactivate;
+        const double OldFlightGravity = OldLaunch + FlightUpdates * (32.0 + OldVelocity) + OldDeactivate;
+        const double NewFlight = NewLaunch + NewDeactivate;
+
+        UE_LOG(LogTemp, Log, TEXT("ProjectileBytes: %d samples, %.2f s flight at %.0f Hz (%d in-flight updates), property payload only"),
+            Samples, FlightSeconds, NetHz, FlightUpdates);
+        UE_LOG(LogTemp, Log, TEXT("ProjectileBytes:   launch      old %6.1f bits   new %6.1f bits"), OldLaunch, NewLaunch);
+        UE_LOG(LogTemp, Log, TEXT("ProjectileBytes:   per update  old %6.1f bits (%.1f with gravity)   new 0 bits"), 32.0, 32.0 + OldVelocity);
+        UE_LOG(LogTemp, Log, TEXT("ProjectileBytes:   projectile  old %.1f B (%.1f B with gravity)   new %.1f B"),
+            OldFlightNoGravity / 8.0, OldFlightGravity / 8.0, NewFlight / 8.0);
+        UE_LOG(LogTemp, Log, TEXT("ProjectileBytes:   max error   location %.3f cm, speed %.3f cm/s, direction %.4f deg, decode %s"),
+            MaxLocationError, MaxSpeedError, MaxAngleErrorDeg, bAllDecoded ? TEXT("ok") : TEXT("FAILED"));
+    }));
@@ -0,0 +1,87 @@
+#include "Gameplay/Combat/ShooterCombatEventSubsystem.h"
+
+#include "Engine/World.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTime.h"
+#include "ProfilingDebugging/CsvProfiler.h"
+
+DECLARE_STATS_GROUP(TEXT("ShooterCombat"), STATGROUP_ShooterCombat, STATCAT_Advanced);
+
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Health Events"), STAT_ShooterCombatHealthEvents, STATGROUP_ShooterCombat);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Damage Events"), STAT_ShooterCombatDamageEvents, STATGROUP_ShooterCombat);
+DECLARE_FLOAT_ACCUMULATOR_STAT(TEXT("Damage"), STAT_ShooterCombatDamage, STATGROUP_ShooterCombat);
+
+CSV_DEFINE_CATEGORY(ShooterCombat, true);
+
+static FAutoConsoleCommandWithWorld CmdCombatDamageReport(
+    TEXT("colosseum.Combat.DamageReport"),
+    TEXT("Logs damage throughput seen by the combat event bus since the last reset."),
+    FConsoleCommandWithWorldDelegate::CreateLambda([](UWorld* World)
+    {
+        if (const UShooterCombatEventSubsystem* Events = World ? World->GetSubsystem<UShooterCombatEventSubsystem>() : nullptr)
+        {
+            Events->LogDamageReport();
+        }
+    }));
+
+static FAutoConsoleCommandWithWorld CmdCombatDamageReset(
+    TEXT("colosseum.Combat.DamageReset"),
+    TEXT("Resets the combat event bus damage counters."),
+    FConsoleCommandWithWorldDelegate::CreateLambda([](UWorld* World)
+    {
+        if (UShooterCombatEventSubsystem* Events = World ? World->GetSubsystem<UShooterCombatEventSubsystem>() : nullptr)
+        {
+            Events->ResetDamageStats();
+        }
+    }));
+
+void UShooterCombatEventSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+    Super::Initialize(Collection);
+    ResetDamageStats();
+}
+
+void UShooterCombatEventSubsystem::PublishHealthChanged(const FShooterHealthEvent& Event)
+{
+    INC_DWORD_STAT(STAT_ShooterCombatHealthEvents);
+
+    const float Delta = Event.NewHealth - Event.OldHealth;
+    if (Delta < 0.f)
+    {
+        ++NumDamageEvents;
+        TotalDamage -= Delta;
+
+        INC_DWORD_STAT(STAT_ShooterCombatDamageEvents);
+        INC_FLOAT_STAT_BY(STAT_ShooterCombatDamage, -Delta);
+        CSV_CUSTOM_STAT(ShooterCombat, Damage, -Delta, ECsvCustomStatOp::Accumulate);
+    }
+    else
+    {
+        TotalHealing += Delta;
+    }
+
+    OnHealthChanged.Broadcast(Event);
+
+    if (Event.OldHealth > 0.f && Event.NewHealth <= 0.f)
+    {
+        ++NumDepleted;
+        OnHealthDepleted.Broadcast(Event);
+    }
+}
+
+void UShooterCombatEventSubsystem::ResetDamageStats()
+{
+    StatsStartTime = FPlatformTime::Seconds();
+    NumDamageEvents = 0;
+    NumDepleted = 0;
+    TotalDamage = 0.0;
+    TotalHealing = 0.0;
+}
+
+void UShooterCombatEventSubsystem::LogDamageReport() const
+{
+    const double Seconds = FMath::Max(FPlatformTime::Seconds() - StatsStartTime, 0.001);
+
+    UE_LOG(LogTemp, Log, TEXT("ShooterCombatEvents: %.1f s, %d damage events (%.1f/s), %.0f damage (%.1f/s), %.0f healing, %d depleted"),
+        Seconds, NumDamageEvents, NumDamageEvents / Seconds, TotalDamage, TotalDamage / Seconds, TotalHealing, NumDepleted);
+}
@@ -1,4 +1,5 @@
 #include "Gameplay/Combat/Weapons/Base/ShooterWeaponBase.h"
+#include "Gameplay/Net/ShooterPushModel.h"
 #include "Gameplay/Tags/ShooterGameplayTags.h"
 
 #include "Net/UnrealNetwork.h"
@@ -9,6 +10,9 @@ AShooterWeaponBase::AShooterWeaponBase()
 	PrimaryActorTick.bCanEverTick = false;
 	bReplicates = true;
 
+	// Relevant exactly when the wielder is, so weapons never replicate to connections that cannot see their owner
+	bNetUseOwnerRelevancy = true;
+
 	// Sensible defaults for tags (can be overridden per-asset/child)
 	WeaponClassTag = ShooterTags::Weapon_Class_AR;				// arbitrary default
 	DamageTypeTag = ShooterTags::Damage_Ballistic;				// default damage channel
@@ -76,6 +80,29 @@ void AShooterWeaponBase::Server_StopFire_Implementation()
     HandleStopFire_Internal();
 }
 
+void AShooterWeaponBase::ResetWeaponState()
+{
+	if (!HasAuthority())
+	{
+		return;
+	}
+
+	HandleStopFire_Internal();
+
+	const FGameplayTag DefaultFireMode = GetClass()->GetDefaultObject<AShooterWeaponBase>()->CurrentFireModeTag;
+	if (CurrentFireModeTag != DefaultFireMode)
+	{
+		CurrentFireModeTag = DefaultFireMode;
+		SHOOTER_MARK_DIRTY(AShooterWeaponBase, CurrentFireModeTag, this);
+	}
+
+	if (bIsReloading)
+	{
+		bIsReloading = false;
+		SHOOTER_MARK_DIRTY(AShooterWeaponBase, bIsReloading, this);
+	}
+}
+
 bool AShooterWeaponBase::CanPerformAction() const
 {
 	// Extend this in child if you add cooldowns/overheats/etc.
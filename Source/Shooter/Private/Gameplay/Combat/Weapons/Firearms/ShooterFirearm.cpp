@@ -1,4 +1,5 @@
 #include "Gameplay/Combat/Weapons/Firearms/ShooterFirearm.h"
+#include "Gameplay/AI/Crowd/ShooterCrowdSubsystem.h"
 #include "Gameplay/Characters/ShooterCombatCharacter.h"
 
 // SKG
@@ -164,6 +165,16 @@ void AShooterFirearm::HandleStopFire_Internal()
 	}
 }
 
+void AShooterFirearm::ResetWeaponState()
+{
+	Super::ResetWeaponState();
+
+	// Pending burst shots would otherwise carry over to the next activation
+	ClearFireTimers();
+	PressCount = 0;
+	ReleaseCount = 0;
+}
+
 void AShooterFirearm::BeginAutoIfNeeded()
 {
 	if (CurrentFireModeTag == ShooterTags::Weapon_FireMode_Auto)
@@ -343,14 +354,6 @@ void AShooterFirearm::OnBulletHit_TB(const FTBImpactParams& Impact)
 		}
 	}
 
-	// Source ASC (weapon owner) -> Target ASC (hit actor)
-	UAbilitySystemComponent* SourceASC = UAbilitySystemGlobals::GetAbilitySystemComponentFromActor(GetOwner());
-	UAbilitySystemComponent* TargetASC = UAbilitySystemGlobals::GetAbilitySystemComponentFromActor(HitActor);
-	if (!SourceASC || !TargetASC)
-		return;
-	if (!SourceASC || !TargetASC)
-		return;
-
 	// --- Compute basic ballistic energy scalar ---
 	UBulletDataAsset* Bullet = nullptr;
 
@@ -383,6 +386,19 @@ void AShooterFirearm::OnBulletHit_TB(const FTBImpactParams& Impact)
 		KE
 	);
 
+	// Crowd entities are instances on a proxy actor, not GAS targets
+	if (UShooterCrowdSubsystem* Crowd = GetWorld()->GetSubsystem<UShooterCrowdSubsystem>())
+	{
+		if (Crowd->ApplyHitDamage(Impact.HitResult, ImpactEnergy))
+			return;
+	}
+
+	// Source ASC (weapon owner) -> Target ASC (hit actor)
+	UAbilitySystemComponent* SourceASC = UAbilitySystemGlobals::GetAbilitySystemComponentFromActor(GetOwner());
+	UAbilitySystemComponent* TargetASC = UAbilitySystemGlobals::GetAbilitySystemComponentFromActor(HitActor);
+	if (!SourceASC || !TargetASC)
+		return;
+
 	// --- Load ballistic damage GE from soft reference ---
 	TSubclassOf<UGameplayEffect> DamageGE = DamageGameplayEffectClass.LoadSynchronous();
 	if (!DamageGE)
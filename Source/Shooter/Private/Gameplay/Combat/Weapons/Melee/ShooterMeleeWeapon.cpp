@@ -2,6 +2,8 @@
 
 
 #include "Gameplay/Combat/Weapons/Melee/ShooterMeleeWeapon.h"
+#include "Gameplay/AI/Crowd/ShooterCrowdSubsystem.h"
+#include "Gameplay/Arena/ShooterArenaCollisionSubsystem.h"
 
 #include "AbilitySystemComponent.h"
 #include "AbilitySystemGlobals.h"
@@ -83,7 +85,10 @@ void AShooterMeleeWeapon::HandleFire_Internal()
     }
 
     // === Line trace ===
-    if (GetWorld()->LineTraceSingleByChannel(Hit, Start, End, ECC_Pawn, Params))
+    const UShooterArenaCollisionSubsystem* ArenaCollision = GetWorld()->GetSubsystem<UShooterArenaCollisionSubsystem>();
+    const ECollisionChannel TraceChannel = ArenaCollision ? ArenaCollision->GetCombatTraceChannel(Start, ECC_Pawn) : ECC_Pawn;
+
+    if (GetWorld()->LineTraceSingleByChannel(Hit, Start, End, TraceChannel, Params))
     {
         AActor* HitActor = Hit.GetActor();
 
@@ -96,7 +101,15 @@ void AShooterMeleeWeapon::HandleFire_Internal()
                 FVector::Dist(Start, Hit.ImpactPoint));
         }
 
-        if (HitActor && DamageEffect)
+        UShooterCrowdSubsystem* Crowd = GetWorld()->GetSubsystem<UShooterCrowdSubsystem>();
+        if (Crowd && Crowd->ApplyHitDamage(Hit, Damage))
+        {
+            if (bDrawDebug)
+            {
+                UE_LOG(LogTemp, Warning, TEXT("[Melee] Applied %.1f damage to a crowd entity"), Damage);
+            }
+        }
+        else if (HitActor && DamageEffect)
         {
             UAbilitySystemComponent* SourceASC = UAbilitySystemGlobals::GetAbilitySystemComponentFromActor(OwnerChar);
             UAbilitySystemComponent* TargetASC = UAbilitySystemGlobals::GetAbilitySystemComponentFromActor(HitActor);
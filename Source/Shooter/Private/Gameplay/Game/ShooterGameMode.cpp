@@ -3,6 +3,14 @@
 #include "Gameplay/Game/ShooterGameMode.h"
 #include "Gameplay/Characters/Player/ShooterCharacter.h"
 #include "Gameplay/Characters/Player/ShooterPlayerController.h"
+#include "Gameplay/Run/ShooterRunHostSubsystem.h"
+#include "Kismet/GameplayStatics.h"
+
+static TAutoConsoleVariable<int32> CVarReviveInPlace(
+    TEXT("colosseum.Player.ReviveInPlace"),
+    1,
+    TEXT("Respawn dead players by resetting their existing pawn (0 = destroy and spawn a new pawn)."),
+    ECVF_Cheat);
 
 AShooterGameMode::AShooterGameMode()
 {
@@ -15,6 +23,45 @@ AShooterGameMode::AShooterGameMode()
     // HUDClass         = AShooterHUD::StaticClass();
 }
 
+void AShooterGameMode::InitGame(const FString& MapName, const FString& Options, FString& ErrorMessage)
+{
+    Super::InitGame(MapName, Options, ErrorMessage);
+
+    const bool bHostRuns = bHostConcurrentRuns
+        || UGameplayStatics::HasOption(Options, TEXT("HostRuns"))
+        || FParse::Param(FCommandLine::Get(), TEXT("HostRuns"));
+
+    if (bHostRuns)
+    {
+        if (UShooterRunHostSubsystem* Host = GetWorld()->GetSubsystem<UShooterRunHostSubsystem>())
+        {
+            Host->EnableHosting();
+        }
+    }
+}
+
+void AShooterGameMode::HandleStartingNewPlayer_Implementation(APlayerController* NewPlayer)
+{
+    Super::HandleStartingNewPlayer_Implementation(NewPlayer);
+
+    // Every joining player gets their own run
+    UShooterRunHostSubsystem* Host = GetWorld()->GetSubsystem<UShooterRunHostSubsystem>();
+    if (Host && Host->IsHostingRuns())
+    {
+        Host->StartRun(NewPlayer);
+    }
+}
+
+void AShooterGameMode::Logout(AController* Exiting)
+{
+    if (UShooterRunHostSubsystem* Host = GetWorld()->GetSubsystem<UShooterRunHostSubsystem>())
+    {
+        Host->EndRun(Exiting);
+    }
+
+    Super::Logout(Exiting);
+}
+
 void AShooterGameMode::RequestRespawn(AController* Controller)
 {
     if (!Controller) return;
@@ -24,9 +71,40 @@ void AShooterGameMode::RequestRespawn(AController* Controller)
     GetWorldTimerManager().SetTimer(RespawnTimer, RespawnDelegate, 2.0f, false);
 }
 
+bool AShooterGameMode::RevivePlayer(AController* Controller)
+{
+    if (!Controller || CVarReviveInPlace.GetValueOnGameThread() == 0)
+    {
+        return false;
+    }
+
+    AShooterCharacter* Character = Cast<AShooterCharacter>(Controller->GetPawn());
+    if (!Character || !Character->IsDead())
+    {
+        return false;
+    }
+
+    AActor* Start = FindPlayerStart(Controller);
+    if (!Start)
+    {
+        return false;
+    }
+
+    // Same spawn point and facing RestartPlayer would use
+    FRotator SpawnRotation = Start->GetActorRotation();
+    SpawnRotation.Pitch = 0.f;
+    SpawnRotation.Roll = 0.f;
+
+    Character->ReviveAt(FTransform(SpawnRotation, Start->GetActorLocation()));
+    return true;
+}
+
 void AShooterGameMode::RespawnPlayer(AController* Controller)
 {
     if (!Controller) return;
 
-    RestartPlayer(Controller);
+    if (!RevivePlayer(Controller))
+    {
+        RestartPlayer(Controller);
+    }
 }
@@ -2,6 +2,9 @@
 
 
 #include "Gameplay/Interaction/InteractableComponent.h"
+#include "Gameplay/Interaction/InteractableRegistrySubsystem.h"
+
+#include "Engine/World.h"
 
 UInteractableComponent::UInteractableComponent()
 {
@@ -17,6 +20,24 @@ UInteractableComponent::UInteractableComponent()
 void UInteractableComponent::BeginPlay()
 {
     Super::BeginPlay();
+
+    if (bIsInteractable)
+    {
+        if (UInteractableRegistrySubsystem* Registry = GetWorld()->GetSubsystem<UInteractableRegistrySubsystem>())
+        {
+            Registry->Register(this);
+        }
+    }
+}
+
+void UInteractableComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    if (UInteractableRegistrySubsystem* Registry = GetWorld() ? GetWorld()->GetSubsystem<UInteractableRegistrySubsystem>() : nullptr)
+    {
+        Registry->Unregister(this);
+    }
+
+    Super::EndPlay(EndPlayReason);
 }
 
 bool UInteractableComponent::CanInteract(AActor* InteractingActor) const
@@ -50,4 +71,19 @@ bool UInteractableComponent::Interact(AActor* InteractingActor)
 void UInteractableComponent::SetInteractable(bool bNewState)
 {
     bIsInteractable = bNewState;
+
+    UInteractableRegistrySubsystem* Registry = HasBegunPlay() && GetWorld() ? GetWorld()->GetSubsystem<UInteractableRegistrySubsystem>() : nullptr;
+    if (!Registry)
+    {
+        return;
+    }
+
+    if (bNewState)
+    {
+        Registry->Register(this);
+    }
+    else
+    {
+        Registry->Unregister(this);
+    }
 }
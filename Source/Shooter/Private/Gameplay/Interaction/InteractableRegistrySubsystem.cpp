@@ -0,0 +1,214 @@
+#include "Gameplay/Interaction/InteractableRegistrySubsystem.h"
+#include "Gameplay/Interaction/InteractableComponent.h"
+
+#include "Components/SceneComponent.h"
+#include "GameFramework/Actor.h"
+
+void UInteractableRegistrySubsystem::Deinitialize()
+{
+    for (const TPair<TObjectKey<USceneComponent>, FDelegateHandle>& Pair : MoveHandles)
+    {
+        if (USceneComponent* Root = Pair.Key.ResolveObjectPtr())
+        {
+            Root->TransformUpdated.Remove(Pair.Value);
+        }
+    }
+
+    MoveHandles.Empty();
+    Cells.Empty();
+    CellByInteractable.Empty();
+
+    Super::Deinitialize();
+}
+
+FIntPoint UInteractableRegistrySubsystem::GetCell(const FVector& Location)
+{
+    return FIntPoint(FMath::FloorToInt(Location.X / CellSize), FMath::FloorToInt(Location.Y / CellSize));
+}
+
+template <typename Func>
+void UInteractableRegistrySubsystem::ForEachInRadius(const FVector& Location, float Radius, Func&& Visit) const
+{
+    const float RadiusSq = Radius * Radius;
+    const FIntPoint Min = GetCell(Location - FVector(Radius, Radius, 0.f));
+    const FIntPoint Max = GetCell(Location + FVector(Radius, Radius, 0.f));
+
+    for (int32 X = Min.X; X <= Max.X; ++X)
+    {
+        for (int32 Y = Min.Y; Y <= Max.Y; ++Y)
+        {
+            const TArray<TWeakObjectPtr<UInteractableComponent>>* Bucket = Cells.Find(FIntPoint(X, Y));
+            if (!Bucket)
+            {
+                continue;
+            }
+
+            for (const TWeakObjectPtr<UInteractableComponent>& Weak : *Bucket)
+            {
+                UInteractableComponent* Interactable = Weak.Get();
+                const AActor* Owner = Interactable ? Interactable->GetOwner() : nullptr;
+                if (!Owner)
+                {
+                    continue;
+                }
+
+                const float DistSq = FVector::DistSquared(Owner->GetActorLocation(), Location);
+                if (DistSq <= RadiusSq && !Visit(Interactable, DistSq))
+                {
+                    return;
+                }
+            }
+        }
+    }
+}
+
+// --- Registration ---
+
+void UInteractableRegistrySubsystem::Register(UInteractableComponent* Interactable)
+{
+    AActor* Owner = Interactable ? Interactable->GetOwner() : nullptr;
+    if (!Owner || CellByInteractable.Contains(Interactable))
+    {
+        return;
+    }
+
+    AddToCell(Interactable, GetCell(Owner->GetActorLocation()));
+
+    // Static terminals/pedestals never move; only movable roots need re-hashing
+    USceneComponent* Root = Owner->GetRootComponent();
+    if (Root && Root->Mobility == EComponentMobility::Movable && !MoveHandles.Contains(Root))
+    {
+        MoveHandles.Add(Root, Root->TransformUpdated.AddUObject(this, &UInteractableRegistrySubsystem::OnOwnerTransformUpdated));
+    }
+}
+
+void UInteractableRegistrySubsystem::Unregister(UInteractableComponent* Interactable)
+{
+    FIntPoint Cell;
+    if (!Interactable || !CellByInteractable.RemoveAndCopyValue(Interactable, Cell))
+    {
+        return;
+    }
+
+    RemoveFromCell(Interactable, Cell);
+
+    AActor* Owner = Interactable->GetOwner();
+    USceneComponent* Root = Owner ? Owner->GetRootComponent() : nullptr;
+    if (!Root)
+    {
+        return;
+    }
+
+    TInlineComponentArray<UInteractableComponent*> Siblings(Owner);
+    for (const UInteractableComponent* Sibling : Siblings)
+    {
+        if (CellByInteractable.Contains(Sibling))
+        {
+            return;
+        }
+    }
+
+    FDelegateHandle Handle;
+    if (MoveHandles.RemoveAndCopyValue(Root, Handle))
+    {
+        Root->TransformUpdated.Remove(Handle);
+    }
+}
+
+bool UInteractableRegistrySubsystem::IsRegistered(const UInteractableComponent* Interactable) const
+{
+    return Interactable && CellByInteractable.Contains(Interactable);
+}
+
+void UInteractableRegistrySubsystem::AddToCell(UInteractableComponent* Interactable, const FIntPoint& Cell)
+{
+    Cells.FindOrAdd(Cell).Add(Interactable);
+    CellByInteractable.Add(Interactable, Cell);
+}
+
+void UInteractableRegistrySubsystem::RemoveFromCell(const UInteractableComponent* Interactable, const FIntPoint& Cell)
+{
+    TArray<TWeakObjectPtr<UInteractableComponent>>* Bucket = Cells.Find(Cell);
+    if (!Bucket)
+    {
+        return;
+    }
+
+    // Also drops entries whose component was destroyed without EndPlay
+    Bucket->RemoveAllSwap([Interactable](const TWeakObjectPtr<UInteractableComponent>& Weak)
+    {
+        return !Weak.IsValid() || Weak.Get() == Interactable;
+    });
+
+    if (Bucket->Num() == 0)
+    {
+        Cells.Remove(Cell);
+    }
+}
+
+void UInteractableRegistrySubsystem::OnOwnerTransformUpdated(USceneComponent* Root, EUpdateTransformFlags Flags, ETeleportType Teleport)
+{
+    AActor* Owner = Root ? Root->GetOwner() : nullptr;
+    if (!Owner)
+    {
+        return;
+    }
+
+    const FIntPoint NewCell = GetCell(Owner->GetActorLocation());
+
+    TInlineComponentArray<UInteractableComponent*> Interactables(Owner);
+    for (UInteractableComponent* Interactable : Interactables)
+    {
+        const FIntPoint* OldCell = CellByInteractable.Find(Interactable);
+        if (OldCell && *OldCell != NewCell)
+        {
+            const FIntPoint Cell = *OldCell;
+            CellByInteractable.Remove(Interactable);
+            RemoveFromCell(Interactable, Cell);
+            AddToCell(Interactable, NewCell);
+        }
+    }
+}
+
+// --- Queries ---
+
+UInteractableComponent* UInteractableRegistrySubsystem::FindNearestInteractable(const FVector& Location, float Radius, AActor* Interactor) const
+{
+    UInteractableComponent* Best = nullptr;
+    float BestDistSq = TNumericLimits<float>::Max();
+
+    ForEachInRadius(Location, Radius, [&](UInteractableComponent* Interactable, float DistSq)
+    {
+        if (DistSq < BestDistSq && Interactable->CanInteract(Interactor))
+        {
+            Best = Interactable;
+            BestDistSq = DistSq;
+        }
+        return true;
+    });
+
+    return Best;
+}
+
+bool UInteractableRegistrySubsystem::HasInteractableWithin(const FVector& Location, float Radius) const
+{
+    bool bFound = false;
+    ForEachInRadius(Location, Radius, [&bFound](UInteractableComponent*, float)
+    {
+        bFound = true;
+        return false;
+    });
+
+    return bFound;
+}
+
+bool UInteractableRegistrySubsystem::IsUsableBy(const UInteractableComponent* Interactable, const AActor* Interactor, float Radius) const
+{
+    if (!IsRegistered(Interactable) || !Interactor || !Interactable->GetOwner())
+    {
+        return false;
+    }
+
+    return FVector::DistSquared(Interactable->GetOwner()->GetActorLocation(), Interactor->GetActorLocation()) <= Radius * Radius
+        && Interactable->CanInteract(const_cast<AActor*>(Interactor));
+}
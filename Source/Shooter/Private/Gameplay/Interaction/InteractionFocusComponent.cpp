@@ -0,0 +1,146 @@
+#include "Gameplay/Interaction/InteractionFocusComponent.h"
+#include "Gameplay/Interaction/InteractableComponent.h"
+#include "Gameplay/Interaction/InteractableRegistrySubsystem.h"
+
+#include "Camera/PlayerCameraManager.h"
+#include "Engine/World.h"
+#include "GameFramework/Pawn.h"
+#include "GameFramework/PlayerController.h"
+
+static TAutoConsoleVariable<int32> CVarInteractFocusFrameInterval(
+    TEXT("colosseum.Interact.FocusFrameInterval"),
+    3,
+    TEXT("Frames between interaction focus traces for the local player."),
+    ECVF_Cheat);
+
+UInteractionFocusComponent::UInteractionFocusComponent()
+{
+    PrimaryComponentTick.bCanEverTick = true;
+    PrimaryComponentTick.TickGroup = TG_PostPhysics;
+
+    TraceDelegate.BindUObject(this, &UInteractionFocusComponent::OnAsyncTraceDone);
+}
+
+void UInteractionFocusComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    PendingTrace = FTraceHandle();
+    SetFocus(nullptr, 0.f);
+
+    Super::EndPlay(EndPlayReason);
+}
+
+void UInteractionFocusComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
+{
+    Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+
+    if (!IsLocalViewer())
+    {
+        return;
+    }
+
+    if (FramesUntilQuery > 0)
+    {
+        --FramesUntilQuery;
+        return;
+    }
+
+    RequestAsyncTrace();
+}
+
+bool UInteractionFocusComponent::IsLocalViewer() const
+{
+    const APawn* Pawn = Cast<APawn>(GetOwner());
+    return Pawn && Pawn->IsLocallyControlled() && Pawn->IsPlayerControlled();
+}
+
+bool UInteractionFocusComponent::GetTraceSegment(FVector& OutStart, FVector& OutEnd) const
+{
+    const APawn* Pawn = Cast<APawn>(GetOwner());
+    const APlayerController* PC = Pawn ? Cast<APlayerController>(Pawn->GetController()) : nullptr;
+    const APlayerCameraManager* Cam = PC ? PC->PlayerCameraManager.Get() : nullptr;
+    if (!Cam)
+    {
+        return false;
+    }
+
+    OutStart = Cam->GetCameraLocation();
+    OutEnd = OutStart + Cam->GetActorForwardVector() * TraceDistance;
+    return true;
+}
+
+bool UInteractionFocusComponent::AnyInteractableInReach(const FVector& ViewLocation) const
+{
+    const UInteractableRegistrySubsystem* Registry = GetWorld()->GetSubsystem<UInteractableRegistrySubsystem>();
+    return !Registry || Registry->HasInteractableWithin(ViewLocation, TraceDistance + MaxInteractableExtent);
+}
+
+// --- Async (local player) ---
+
+void UInteractionFocusComponent::RequestAsyncTrace()
+{
+    UWorld* World = GetWorld();
+    if (!World)
+    {
+        return;
+    }
+
+    // One query in flight; results arrive next frame
+    if (World->IsTraceHandleValid(PendingTrace, false))
+    {
+        return;
+    }
+
+    FVector Start, End;
+    if (!GetTraceSegment(Start, End) || !AnyInteractableInReach(Start))
+    {
+        SetFocus(nullptr, 0.f);
+        return;
+    }
+
+    FCollisionQueryParams Params(SCENE_QUERY_STAT(InteractFocusTrace), false, GetOwner());
+    PendingTrace = World->AsyncLineTraceByChannel(EAsyncTraceType::Single, Start, End, TraceChannel, Params,
+        FCollisionResponseParams::DefaultResponseParam, &TraceDelegate);
+
+    FramesUntilQuery = (uint32)FMath::Max(CVarInteractFocusFrameInterval.GetValueOnGameThread() - 1, 0);
+}
+
+void UInteractionFocusComponent::OnAsyncTraceDone(const FTraceHandle& Handle, FTraceDatum& Data)
+{
+    if (Handle != PendingTrace)
+    {
+        return;
+    }
+    PendingTrace = FTraceHandle();
+
+    const FHitResult* Hit = Data.OutHits.Num() > 0 ? &Data.OutHits[0] : nullptr;
+    if (Hit && Hit->bBlockingHit)
+    {
+        SetFocus(Hit->GetActor(), Hit->Distance);
+    }
+    else
+    {
+        SetFocus(nullptr, 0.f);
+    }
+}
+
+void UInteractionFocusComponent::SetFocus(AActor* HitActor, float Distance)
+{
+    FocusDistance = Distance;
+
+    // Component lookup only when the hit actor changes
+    if (HitActor && HitActor == FocusedActor.Get())
+    {
+        return;
+    }
+
+    FocusedActor = HitActor;
+    UInteractableComponent* NewFocus = HitActor ? HitActor->FindComponentByClass<UInteractableComponent>() : nullptr;
+
+    if (NewFocus == FocusedInteractable.Get())
+    {
+        return;
+    }
+
+    FocusedInteractable = NewFocus;
+    OnFocusChanged.Broadcast(NewFocus);
+}
@@ -0,0 +1,143 @@
+#include "Gameplay/Net/ShooterNetRelevancySubsystem.h"
+#include "Gameplay/Characters/ShooterCombatCharacter.h"
+
+#include "Engine/World.h"
+
+static TAutoConsoleVariable<int32> CVarNetAdaptivePawnRates(
+    TEXT("colosseum.Net.AdaptivePawnRates"),
+    1,
+    TEXT("Scale combat pawn NetUpdateFrequency by distance to players and activity (0 = authored rates)."),
+    ECVF_Cheat);
+
+static TAutoConsoleVariable<float> CVarNetNearDistance(
+    TEXT("colosseum.Net.NearDistance"),
+    3000.f,
+    TEXT("Pawns within this distance of a player replicate at their full rate."),
+    ECVF_Cheat);
+
+static TAutoConsoleVariable<float> CVarNetFarDistance(
+    TEXT("colosseum.Net.FarDistance"),
+    8000.f,
+    TEXT("Pawns beyond this distance from every player replicate at the lowest band."),
+    ECVF_Cheat);
+
+static TAutoConsoleVariable<float> CVarNetInactiveRate(
+    TEXT("colosseum.Net.InactiveRate"),
+    2.f,
+    TEXT("NetUpdateFrequency of dead or pooled combat pawns."),
+    ECVF_Cheat);
+
+// Rates are re-evaluated at this interval, not every frame
+static constexpr float NetPolicyInterval = 0.25f;
+
+TStatId UShooterNetRelevancySubsystem::GetStatId() const
+{
+    RETURN_QUICK_DECLARE_CYCLE_STAT(UShooterNetRelevancySubsystem, STATGROUP_Tickables);
+}
+
+void UShooterNetRelevancySubsystem::RegisterPawn(AShooterCombatCharacter* Pawn)
+{
+    if (!Pawn || !Pawn->HasAuthority())
+    {
+        return;
+    }
+
+    for (const FPawnEntry& Entry : Pawns)
+    {
+        if (Entry.Pawn.Get() == Pawn)
+        {
+            return;
+        }
+    }
+
+    FPawnEntry& Entry = Pawns.AddDefaulted_GetRef();
+    Entry.Pawn = Pawn;
+    Entry.BaseRate = Pawn->GetNetUpdateFrequency();
+    Entry.BaseMinRate = Pawn->GetMinNetUpdateFrequency();
+}
+
+void UShooterNetRelevancySubsystem::Tick(float DeltaTime)
+{
+    const UWorld* World = GetWorld();
+    if (!World || World->GetNetMode() == NM_Client || World->GetNetMode() == NM_Standalone)
+    {
+        return;
+    }
+
+    TimeUntilUpdate -= DeltaTime;
+    if (TimeUntilUpdate > 0.f)
+    {
+        return;
+    }
+    TimeUntilUpdate = NetPolicyInterval;
+
+    UpdateRates();
+}
+
+void UShooterNetRelevancySubsystem::UpdateRates()
+{
+    Pawns.RemoveAllSwap([](const FPawnEntry& Entry) { return !Entry.Pawn.IsValid(); });
+
+    const bool bAdaptive = CVarNetAdaptivePawnRates.GetValueOnGameThread() != 0;
+
+    // Viewers: living player pawns
+    TArray<FVector, TInlineAllocator<8>> PlayerLocations;
+    for (const FPawnEntry& Entry : Pawns)
+    {
+        const AShooterCombatCharacter* Pawn = Entry.Pawn.Get();
+        if (Pawn->IsPlayerControlled() && !Pawn->IsDead())
+        {
+            PlayerLocations.Add(Pawn->GetActorLocation());
+        }
+    }
+
+    const float NearSq = FMath::Square(CVarNetNearDistance.GetValueOnGameThread());
+    const float FarSq = FMath::Square(CVarNetFarDistance.GetValueOnGameThread());
+    const float InactiveRate = CVarNetInactiveRate.GetValueOnGameThread();
+
+    for (const FPawnEntry& Entry : Pawns)
+    {
+        AShooterCombatCharacter* Pawn = Entry.Pawn.Get();
+
+        float Rate = Entry.BaseRate;
+        if (bAdaptive)
+        {
+            if (Pawn->IsDead() || Pawn->IsHidden())
+            {
+                Rate = InactiveRate;
+            }
+            else if (Pawn->IsPlayerControlled())
+            {
+                // NetUpdateFrequency is per actor: banding a player by its distance to other players
+                // would throttle it toward its own connection too (and concurrent runs sit far apart)
+                Rate = Entry.BaseRate;
+            }
+            else
+            {
+                const FVector Location = Pawn->GetActorLocation();
+                float ClosestSq = TNumericLimits<float>::Max();
+                for (const FVector& PlayerLocation : PlayerLocations)
+                {
+                    ClosestSq = FMath::Min(ClosestSq, FVector::DistSquared(PlayerLocation, Location));
+                }
+
+                int32 Band = ClosestSq <= NearSq ? 0 : (ClosestSq <= FarSq ? 1 : 2);
+
+                const bool bIdle = Pawn->GetVelocity().SizeSquared() < FMath::Square(10.f);
+                if (bIdle)
+                {
+                    Band = FMath::Min(Band + 1, 2);
+                }
+
+                static const float BandScale[] = { 1.f, 0.5f, 0.2f };
+                Rate = FMath::Max(Entry.BaseRate * BandScale[Band], InactiveRate);
+            }
+        }
+
+        if (!FMath::IsNearlyEqual(Pawn->GetNetUpdateFrequency(), Rate, 0.5f))
+        {
+            Pawn->SetNetUpdateFrequency(Rate);
+            Pawn->SetMinNetUpdateFrequency(FMath::Min(Entry.BaseMinRate, Rate));
+        }
+    }
+}
@@ -0,0 +1,192 @@
+#include "Gameplay/Net/ShooterPushModel.h"
+
+#if SHOOTER_PUSH_MODEL_VALIDATION
+
+#include "Containers/Ticker.h"
+#include "Engine/World.h"
+#include "EngineUtils.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTime.h"
+#include "UObject/UObjectHash.h"
+#include "UObject/UnrealType.h"
+
+namespace ShooterPushModel
+{
+    using FPropertyKey = TPair<FObjectKey, FName>;
+
+    static bool bRecording = false;
+
+    // Marks since the validator's last snapshot
+    static TSet<FPropertyKey> PendingDirty;
+
+    void RecordDirty(const UObject* Object, FName PropertyName)
+    {
+        if (bRecording && Object)
+        {
+            PendingDirty.Add(FPropertyKey(Object, PropertyName));
+        }
+    }
+
+    /**
+     * One colosseum.Net.ValidatePushModel run: every frame, exports each replicated property declared in
+     * this module (actors, their components and attribute sets) and compares it with the previous frame.
+     * A changed value without a dirty mark in between is a write clients would never receive.
+     */
+    struct FValidationRun
+    {
+        TWeakObjectPtr<UWorld> World;
+        double EndTime = 0.0;
+
+        TMap<FPropertyKey, FString> Values;
+
+        // Missed marks per "Class.Property"
+        TMap<FString, int32> Misses;
+        int32 NumChanges = 0;
+        int32 NumFrames = 0;
+
+        void CheckObject(const UObject* Object);
+        void CheckWorld(UWorld& InWorld);
+        void Report() const;
+    };
+
+    static bool IsShooterProperty(const FProperty* Property)
+    {
+        static const FName ShooterPackage(TEXT("/Script/Shooter"));
+        const UClass* OwnerClass = Property->GetOwnerClass();
+        return OwnerClass && OwnerClass->GetOutermost()->GetFName() == ShooterPackage;
+    }
+
+    void FValidationRun::CheckObject(const UObject* Object)
+    {
+        for (TFieldIterator<FProperty> It(Object->GetClass()); It; ++It)
+        {
+            const FProperty* Property = *It;
+            if (!Property->HasAnyPropertyFlags(CPF_Net) || !IsShooterProperty(Property))
+            {
+                continue;
+            }
+
+            FString Value;
+            Property->ExportText_InContainer(0, Value, Object, nullptr, nullptr, PPF_None);
+
+            const FPropertyKey Key(Object, Property->GetFName());
+            FString* Previous = Values.Find(Key);
+            if (!Previous)
+            {
+                // First sight; the initial bunch sends everything
+                Values.Add(Key, MoveTemp(Value));
+                continue;
+            }
+
+            if (*Previous == Value)
+            {
+                continue;
+            }
+
+            ++NumChanges;
+            if (!PendingDirty.Contains(Key))
+            {
+                int32& Count = Misses.FindOrAdd(FString::Printf(TEXT("%s.%s"), *Property->GetOwnerClass()->GetName(), *Property->GetName()));
+                if (Count++ == 0)
+                {
+                    UE_LOG(LogTemp, Error, TEXT("ShooterPushModel: %s.%s on %s changed without a dirty mark (%s -> %s)"),
+                        *Property->GetOwnerClass()->GetName(), *Property->GetName(), *GetNameSafe(Object), **Previous, *Value);
+                }
+            }
+
+            *Previous = MoveTemp(Value);
+        }
+    }
+
+    void FValidationRun::CheckWorld(UWorld& InWorld)
+    {
+        TArray<UObject*> Subobjects;
+        for (TActorIterator<AActor> It(&InWorld); It; ++It)
+        {
+            CheckObject(*It);
+
+            Subobjects.Reset();
+            GetObjectsWithOuter(*It, Subobjects, false);
+            for (const UObject* Subobject : Subobjects)
+            {
+                CheckObject(Subobject);
+            }
+        }
+
+        PendingDirty.Reset();
+        ++NumFrames;
+    }
+
+    void FValidationRun::Report() const
+    {
+        UE_LOG(LogTemp, Log, TEXT("ShooterPushModel: validated %d frames, %d replicated value changes, %d properties with missed marks"),
+            NumFrames, NumChanges, Misses.Num());
+
+        for (const TPair<FString, int32>& Miss : Misses)
+        {
+            UE_LOG(LogTemp, Error, TEXT("ShooterPushModel:   %s missed %d time(s)"), *Miss.Key, Miss.Value);
+        }
+
+        if (Misses.Num() == 0)
+        {
+            UE_LOG(LogTemp, Log, TEXT("ShooterPushModel: PASS"));
+        }
+    }
+
+    static FTSTicker::FDelegateHandle ActiveRun;
+
+    static void StartValidation(UWorld* World, float Seconds)
+    {
+        if (!World || World->GetNetMode() == NM_Client)
+        {
+            UE_LOG(LogTemp, Warning, TEXT("ShooterPushModel: run the validation on the server or in standalone"));
+            return;
+        }
+
+        if (ActiveRun.IsValid())
+        {
+            UE_LOG(LogTemp, Warning, TEXT("ShooterPushModel: a validation run is already active"));
+            return;
+        }
+
+        TSharedRef<FValidationRun> Run = MakeShared<FValidationRun>();
+        Run->World = World;
+        Run->EndTime = FPlatformTime::Seconds() + Seconds;
+
+        bRecording = true;
+        PendingDirty.Reset();
+
+        UE_LOG(LogTemp, Log, TEXT("ShooterPushModel: validating for %.0f s"), Seconds);
+
+        ActiveRun = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateLambda([Run](float)
+        {
+            UWorld* RunWorld = Run->World.Get();
+            if (RunWorld)
+            {
+                Run->CheckWorld(*RunWorld);
+            }
+
+            if (RunWorld && FPlatformTime::Seconds() < Run->EndTime)
+            {
+                return true;
+            }
+
+            Run->Report();
+            bRecording = false;
+            PendingDirty.Reset();
+            ActiveRun.Reset();
+            return false;
+        }));
+    }
+}
+
+static FAutoConsoleCommandWithWorldAndArgs CmdNetValidatePushModel(
+    TEXT("colosseum.Net.ValidatePushModel"),
+    TEXT("colosseum.Net.ValidatePushModel <Seconds=30>: run on the server while playing; reports replicated Shooter properties that changed without being marked dirty."),
+    FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+    {
+        const float Seconds = Args.Num() > 0 ? FCString::Atof(*Args[0]) : 30.f;
+        ShooterPushModel::StartValidation(World, Seconds);
+    }));
+
+#endif // SHOOTER_PUSH_MODEL_VALIDATION
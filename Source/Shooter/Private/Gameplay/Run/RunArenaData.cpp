@@ -3,3 +3,6 @@
 
 #include "Gameplay/Run/RunArenaData.h"
 
+const FName URunArenaData::EnemiesBundle(TEXT("Enemies"));
+const FName URunArenaData::FXBundle(TEXT("FX"));
+const FName URunArenaData::AudioBundle(TEXT("Audio"));
@@ -1,15 +1,24 @@
 #include "Gameplay/Run/RunDirector.h"
 #include "Gameplay/Run/RunDirectorConfig.h"
 #include "Gameplay/Run/RunArenaData.h"
+#include "Gameplay/Abilities/AttrSet_Combat.h"
+#include "Gameplay/Augments/AugmentManagerComponent.h"
 #include "Gameplay/Arena/ArenaManager.h"
 #include "Gameplay/Characters/Player/ShooterCharacter.h"
+#include "Gameplay/Run/ShooterRunHostSubsystem.h"
 #include "Gameplay/Tags/ShooterGameplayTags.h"
+#include "World/ShooterWorldRegistrySubsystem.h"
 
 #include "Kismet/GameplayStatics.h"
 #include "AbilitySystemGlobals.h"
 #include "AbilitySystemComponent.h"
 #include "AbilitySystemBlueprintLibrary.h"
-#include "EngineUtils.h"
+#include "GameplayEffect.h"
+#include "Engine/AssetManager.h"
+#include "Engine/Level.h"
+#include "Engine/LevelStreamingDynamic.h"
+#include "Engine/StreamableManager.h"
+#include "GameFramework/PlayerStart.h"
 
 URunDirector::URunDirector()
 {
@@ -28,7 +37,36 @@ void URunDirector::Initialize(FSubsystemCollectionBase& Collection)
         return;
     }
 
-    URunDirectorConfig* Loaded = ConfigAsset.LoadSynchronous();
+    // Listen for map loads
+    FCoreUObjectDelegates::PostLoadMapWithWorld.AddUObject(
+        this,
+        &URunDirector::OnArenaLevelLoaded
+    );
+
+    // Config (and the arena data it references) loads in the background; StartNewRun waits for it
+    ConfigLoadHandle = UAssetManager::GetStreamableManager().RequestAsyncLoad(
+        ConfigAsset.ToSoftObjectPath(),
+        FStreamableDelegate::CreateUObject(this, &URunDirector::OnConfigLoaded)
+    );
+
+    // Look for an interrupted run off the game thread
+    TWeakObjectPtr<URunDirector> WeakThis(this);
+    FRunSnapshot::ReadAsync(FRunSnapshot::GetDefaultPath(), [WeakThis](bool bLoaded, const FRunSnapshot& Snapshot)
+    {
+        URunDirector* Director = WeakThis.Get();
+        if (Director && bLoaded)
+        {
+            Director->ResumeSnapshot = Snapshot;
+            Director->bHasResumableRun = true;
+
+            UE_LOG(LogTemp, Log, TEXT("RunDirector: Found resumable run %d at arena %d."), Snapshot.RunIndex, Snapshot.ArenaIndex);
+        }
+    });
+}
+
+void URunDirector::OnConfigLoaded()
+{
+    URunDirectorConfig* Loaded = ConfigAsset.Get();
     if (!Loaded)
     {
         UE_LOG(LogTemp, Error, TEXT("RunDirector: Failed to load RunDirectorConfig asset."));
@@ -36,23 +74,48 @@ void URunDirector::Initialize(FSubsystemCollectionBase& Collection)
     }
 
     ArenaSequence = Loaded->ArenaSequence;
+    RunPersistentLevel = Loaded->RunPersistentLevel;
 
-    UE_LOG(LogTemp, Log, TEXT("RunDirector: Loaded %d arenas from config."), ArenaSequence.Num());
+    UE_LOG(LogTemp, Log, TEXT("RunDirector: Loaded %d arenas from config (Streaming=%d)."),
+        ArenaSequence.Num(), UsesArenaStreaming() ? 1 : 0);
 
-    // Listen for map loads
-    FCoreUObjectDelegates::PostLoadMapWithWorld.AddUObject(
-        this,
-        &URunDirector::OnArenaLevelLoaded
-    );
+    if (bStartRunWhenConfigLoaded)
+    {
+        bStartRunWhenConfigLoaded = false;
+        StartNewRun();
+    }
+    else if (bResumeRunWhenConfigLoaded)
+    {
+        bResumeRunWhenConfigLoaded = false;
+        ResumeRun();
+    }
 }
 
 void URunDirector::Deinitialize()
 {
     FCoreUObjectDelegates::PostLoadMapWithWorld.RemoveAll(this);
+
+    if (ConfigLoadHandle.IsValid())
+    {
+        ConfigLoadHandle->CancelHandle();
+        ConfigLoadHandle.Reset();
+    }
+
+    ReleaseAllArenaStreaming();
+    EvictArenaBundlesBefore(MAX_int32);
+
+    Super::Deinitialize();
 }
 
 void URunDirector::StartNewRun()
 {
+    const UShooterRunHostSubsystem* Host = GetWorld() ? GetWorld()->GetSubsystem<UShooterRunHostSubsystem>() : nullptr;
+    if (Host && Host->IsHostingRuns())
+    {
+        UE_LOG(LogTemp, Warning, TEXT("RunDirector: This world hosts concurrent runs; runs are started by the run host."));
+        return;
+    }
+
     BindRunEventsToCurrentASC();
 
     PlayerRef = Cast<AShooterCharacter>(UGameplayStatics::GetPlayerPawn(GetWorld(), 0));
@@ -63,16 +126,16 @@ void URunDirector::StartNewRun()
         return;
     }
 
-    // Subscribe to arena-cleared event for this run
-    if (UAbilitySystemComponent* ASC = UAbilitySystemGlobals::GetAbilitySystemComponentFromActor(PlayerRef))
-    {
-        ASC->GenericGameplayEventCallbacks
-            .FindOrAdd(ShooterTags::Event_Run_ArenaCleared)
-            .AddUObject(this, &URunDirector::OnArenaCleared);
-    }
-
     if (ArenaSequence.Num() == 0)
     {
+        if (ConfigLoadHandle.IsValid() && ConfigLoadHandle->IsLoadingInProgress())
+        {
+            UE_LOG(LogTemp, Log, TEXT("RunDirector: Config still loading, run starts when it is ready."));
+            bStartRunWhenConfigLoaded = true;
+            bResumeRunWhenConfigLoaded = false;
+            return;
+        }
+
         UE_LOG(LogTemp, Error, TEXT("RunDirector: No arenas assigned."));
         return;
     }
@@ -81,6 +144,79 @@ void URunDirector::StartNewRun()
     CurrentRunIndex++;
     CurrentDifficultyTier = 1;
 
+    RunSeed = FMath::Rand();
+    RunRandom.Initialize(RunSeed);
+
+    // A fresh run supersedes whatever was saved
+    bApplyResumeOnArenaStart = false;
+    DeleteRunSnapshot();
+
+    EnterRunAtCurrentArena();
+}
+
+void URunDirector::ResumeRun()
+{
+    if (!bHasResumableRun)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("RunDirector: ResumeRun called without a resumable snapshot."));
+        return;
+    }
+
+    BindRunEventsToCurrentASC();
+
+    if (ArenaSequence.Num() == 0 && ConfigLoadHandle.IsValid() && ConfigLoadHandle->IsLoadingInProgress())
+    {
+        UE_LOG(LogTemp, Log, TEXT("RunDirector: Config still loading, run resumes when it is ready."));
+        bResumeRunWhenConfigLoaded = true;
+        bStartRunWhenConfigLoaded = false;
+        return;
+    }
+
+    if (!ArenaSequence.IsValidIndex(ResumeSnapshot.ArenaIndex))
+    {
+        UE_LOG(LogTemp, Error, TEXT("RunDirector: Snapshot arena index %d is outside the arena sequence (%d)."),
+            ResumeSnapshot.ArenaIndex, ArenaSequence.Num());
+        return;
+    }
+
+    CurrentRunIndex = ResumeSnapshot.RunIndex;
+    CurrentArenaIndex = ResumeSnapshot.ArenaIndex;
+    CurrentDifficultyTier = ResumeSnapshot.DifficultyTier;
+
+    RunSeed = ResumeSnapshot.RandomSeed;
+    RunRandom.Initialize(RunSeed);
+
+    bHasResumableRun = false;
+    bApplyResumeOnArenaStart = true;
+
+    UE_LOG(LogTemp, Log, TEXT("RunDirector: Resuming run %d at arena %d (%d augments)."),
+        CurrentRunIndex, CurrentArenaIndex, ResumeSnapshot.Augments.Num());
+
+    EnterRunAtCurrentArena();
+}
+
+void URunDirector::EnterRunAtCurrentArena()
+{
+    bRunInProgress = true;
+
+    if (UsesArenaStreaming())
+    {
+        const FString CurrentMap = UWorld::RemovePIEPrefix(GetWorld()->GetOutermost()->GetName());
+        if (CurrentMap != RunPersistentLevel.GetLongPackageName())
+        {
+            // One full travel per run; every arena after that is streamed into the run map
+            UE_LOG(LogTemp, Log, TEXT("RunDirector: Travelling to run map '%s'"), *RunPersistentLevel.GetLongPackageName());
+
+            // Start pulling the first arena's enemies in while the run map loads
+            PrefetchArenaBundles(CurrentArenaIndex);
+            PrefetchArenaBundles(CurrentArenaIndex + 1);
+
+            bAwaitingRunMap = true;
+            UGameplayStatics::OpenLevel(GetWorld(), FName(*RunPersistentLevel.GetLongPackageName()));
+            return;
+        }
+    }
+
     LoadArenaByIndex(CurrentArenaIndex);
 }
 
@@ -106,6 +242,14 @@ void URunDirector::LoadArenaByIndex(int32 Index)
         return;
     }
 
+    // Authored tier for this arena, plus one per earlier run this session
+    CurrentDifficultyTier = FMath::Max(1, CurrentArenaData->DifficultyTier) + FMath::Max(0, CurrentRunIndex - 1);
+
+    // Keep exactly this arena and the next one resident
+    PrefetchArenaBundles(Index);
+    PrefetchArenaBundles(Index + 1);
+    EvictArenaBundlesBefore(Index);
+
     // Fire Arena.Start
     UAbilitySystemBlueprintLibrary::SendGameplayEventToActor(
         PlayerRef,
@@ -115,14 +259,432 @@ void URunDirector::LoadArenaByIndex(int32 Index)
 
     const FName LevelName(*CurrentArenaData->ArenaLevel.GetLongPackageName());
 
-    UE_LOG(LogTemp, Log, TEXT("RunDirector: Loading Arena '%s' (Final=%d)"),
+    UE_LOG(LogTemp, Log, TEXT("RunDirector: Loading Arena '%s' (Final=%d, Preloaded=%d)"),
         *LevelName.ToString(),
-        CurrentArenaData->bIsFinalArena ? 1 : 0
+        CurrentArenaData->bIsFinalArena ? 1 : 0,
+        PreloadedArenaIndex == Index ? 1 : 0
     );
 
+    if (UsesArenaStreaming())
+    {
+        ShowStreamedArena(Index);
+        return;
+    }
+
     UGameplayStatics::OpenLevel(GetWorld(), LevelName);
 }
 
+void URunDirector::PreloadArena(int32 Index)
+{
+    if (!UsesArenaStreaming() || !ArenaSequence.IsValidIndex(Index) || PreloadedArenaIndex == Index)
+    {
+        return;
+    }
+
+    ReleaseArenaStreaming(PreloadedArenaStreaming);
+
+    PreloadedArenaStreaming = RequestArenaStreaming(Index);
+    PreloadedArenaIndex = PreloadedArenaStreaming ? Index : INDEX_NONE;
+
+    UE_LOG(LogTemp, Log, TEXT("RunDirector: Preloading arena %d in the background."), Index);
+}
+
+ULevelStreamingDynamic* URunDirector::RequestArenaStreaming(int32 Index)
+{
+    const URunArenaData* Data = ArenaSequence.IsValidIndex(Index) ? ArenaSequence[Index] : nullptr;
+    if (!Data || Data->ArenaLevel.IsNull())
+    {
+        return nullptr;
+    }
+
+    // Loaded but hidden; ShowStreamedArena flips visibility when the arena is entered
+    FLoadLevelInstanceParams Params(GetWorld(), Data->ArenaLevel.GetLongPackageName(), FTransform::Identity);
+    Params.bInitiallyVisible = false;
+
+    bool bSuccess = false;
+    ULevelStreamingDynamic* Streaming = ULevelStreamingDynamic::LoadLevelInstance(Params, bSuccess);
+    if (!bSuccess || !Streaming)
+    {
+        UE_LOG(LogTemp, Error, TEXT("RunDirector: Failed to stream arena level '%s'"), *Data->ArenaLevel.GetLongPackageName());
+        return nullptr;
+    }
+
+    return Streaming;
+}
+
+void URunDirector::ShowStreamedArena(int32 Index)
+{
+    ULevelStreamingDynamic* Streaming = nullptr;
+
+    if (PreloadedArenaIndex == Index && PreloadedArenaStreaming)
+    {
+        Streaming = PreloadedArenaStreaming;
+    }
+    else
+    {
+        ReleaseArenaStreaming(PreloadedArenaStreaming);
+        Streaming = RequestArenaStreaming(Index);
+    }
+
+    PreloadedArenaStreaming = nullptr;
+    PreloadedArenaIndex = INDEX_NONE;
+
+    if (!Streaming)
+    {
+        ReturnToHub();
+        return;
+    }
+
+    // Previous arena unloads in the background
+    ReleaseArenaStreaming(ActiveArenaStreaming);
+    ActiveArenaStreaming = Streaming;
+
+    Streaming->SetShouldBeVisible(true);
+
+    if (Streaming->IsLevelVisible())
+    {
+        OnStreamedArenaShown();
+    }
+    else
+    {
+        Streaming->OnLevelShown.AddUniqueDynamic(this, &URunDirector::OnStreamedArenaShown);
+    }
+}
+
+void URunDirector::OnStreamedArenaShown()
+{
+    if (!ActiveArenaStreaming)
+    {
+        return;
+    }
+
+    ActiveArenaStreaming->OnLevelShown.RemoveAll(this);
+
+    ULevel* Level = ActiveArenaStreaming->GetLoadedLevel();
+    if (!Level)
+    {
+        UE_LOG(LogTemp, Error, TEXT("RunDirector: Streamed arena shown without a loaded level."));
+        return;
+    }
+
+    UE_LOG(LogTemp, Log, TEXT("RunDirector: Streamed arena visible. Searching for ArenaManager."));
+
+    StartArenaInLevel(GetWorld(), Level);
+}
+
+void URunDirector::ReleaseArenaStreaming(ULevelStreamingDynamic* Streaming)
+{
+    if (!Streaming)
+    {
+        return;
+    }
+
+    Streaming->OnLevelShown.RemoveAll(this);
+    Streaming->SetShouldBeVisible(false);
+    Streaming->SetShouldBeLoaded(false);
+    Streaming->SetIsRequestingUnloadAndRemoval(true);
+}
+
+void URunDirector::ReleaseAllArenaStreaming()
+{
+    ReleaseArenaStreaming(ActiveArenaStreaming);
+    ReleaseArenaStreaming(PreloadedArenaStreaming);
+
+    ActiveArenaStreaming = nullptr;
+    PreloadedArenaStreaming = nullptr;
+    PreloadedArenaIndex = INDEX_NONE;
+}
+
+bool URunDirector::StartArenaInLevel(UWorld* World, ULevel* Level)
+{
+    if (!World)
+    {
+        return false;
+    }
+
+    const UShooterWorldRegistrySubsystem* Registry = World->GetSubsystem<UShooterWorldRegistrySubsystem>();
+    AArenaManager* Manager = Registry ? Registry->FindArenaManager(Level) : nullptr;
+
+    if (!Manager)
+    {
+        UE_LOG(LogTemp, Error, TEXT("RunDirector: No ArenaManager found in loaded level."));
+        return false;
+    }
+
+    // The pawn persists across streamed arenas: move it to the arena's entry point
+    if (Level && PlayerRef)
+    {
+        const AActor* Entry = Manager->GetPlayerEntryPoint();
+        if (!Entry)
+        {
+            // Not assigned on the manager: fall back to the streamed level's own PlayerStart
+            for (AActor* Actor : Level->Actors)
+            {
+                if (Cast<APlayerStart>(Actor))
+                {
+                    Entry = Actor;
+                    break;
+                }
+            }
+        }
+
+        if (Entry)
+        {
+            PlayerRef->TeleportTo(Entry->GetActorLocation(), Entry->GetActorRotation());
+            if (AController* Controller = PlayerRef->GetController())
+            {
+                Controller->SetControlRotation(Entry->GetActorRotation());
+            }
+        }
+    }
+
+    // Pass current arena data in:
+    if (ArenaSequence.IsValidIndex(CurrentArenaIndex))
+    {
+        Manager->SetCurrentArenaData(ArenaSequence[CurrentArenaIndex]);
+    }
+
+    if (bApplyResumeOnArenaStart)
+    {
+        bApplyResumeOnArenaStart = false;
+        ApplySnapshotToPlayer(ResumeSnapshot);
+    }
+
+    Manager->StartArena();
+    return true;
+}
+
+void URunDirector::CaptureRunSnapshot(FRunSnapshot& OutSnapshot) const
+{
+    OutSnapshot = FRunSnapshot();
+    OutSnapshot.RunIndex = CurrentRunIndex;
+    OutSnapshot.ArenaIndex = CurrentArenaIndex;
+    OutSnapshot.DifficultyTier = CurrentDifficultyTier;
+    OutSnapshot.RandomSeed = RunSeed;
+
+    if (!PlayerRef)
+    {
+        return;
+    }
+
+    // Base values only: max values come back from the class defaults plus re-applied augments
+    if (const UAbilitySystemComponent* ASC = UAbilitySystemGlobals::GetAbilitySystemComponentFromActor(PlayerRef))
+    {
+        OutSnapshot.Health = ASC->GetNumericAttributeBase(UAttrSet_Combat::GetHealthAttribute());
+        OutSnapshot.Stamina = ASC->GetNumericAttributeBase(UAttrSet_Combat::GetStaminaAttribute());
+    }
+
+    if (const UAugmentManagerComponent* Augments = PlayerRef->FindComponentByClass<UAugmentManagerComponent>())
+    {
+        for (const FAugmentData& Data : Augments->GetAppliedAugments())
+        {
+            FRunSnapshotAugment& Entry = OutSnapshot.Augments.AddDefaulted_GetRef();
+            Entry.DisplayName = Data.DisplayName.ToString();
+            Entry.AugmentTag = Data.AugmentTag;
+            Entry.EffectClass = FSoftClassPath(Data.GameplayEffectClass.Get());
+        }
+    }
+}
+
+void URunDirector::ApplySnapshotToPlayer(const FRunSnapshot& Snapshot)
+{
+    if (!PlayerRef)
+    {
+        return;
+    }
+
+    if (UAugmentManagerComponent* Augments = PlayerRef->FindComponentByClass<UAugmentManagerComponent>())
+    {
+        for (const FRunSnapshotAugment& Entry : Snapshot.Augments)
+        {
+            FAugmentData Data;
+            Data.DisplayName = FText::FromString(Entry.DisplayName);
+            Data.AugmentTag = Entry.AugmentTag;
+            Data.GameplayEffectClass = Entry.EffectClass.TryLoadClass<UGameplayEffect>();
+
+            if (!Data.GameplayEffectClass)
+            {
+                UE_LOG(LogTemp, Warning, TEXT("RunDirector: Snapshot augment effect '%s' no longer exists."), *Entry.EffectClass.ToString());
+                continue;
+            }
+
+            Augments->ApplyAugment(Data);
+        }
+    }
+
+    if (UAbilitySystemComponent* ASC = UAbilitySystemGlobals::GetAbilitySystemComponentFromActor(PlayerRef))
+    {
+        if (Snapshot.Health > 0.f)
+        {
+            ASC->SetNumericAttributeBase(UAttrSet_Combat::GetHealthAttribute(), Snapshot.Health);
+        }
+        ASC->SetNumericAttributeBase(UAttrSet_Combat::GetStaminaAttribute(), Snapshot.Stamina);
+    }
+}
+
+void URunDirector::SaveRunSnapshotAsync()
+{
+    // A finished run must never come back as resumable
+    if (!bRunInProgress)
+    {
+        UE_LOG(LogTemp, Log, TEXT("RunDirector: No run in progress, snapshot not saved."));
+        return;
+    }
+
+    FRunSnapshot Snapshot;
+    CaptureRunSnapshot(Snapshot);
+
+    const int32 ArenaIndex = Snapshot.ArenaIndex;
+    Snapshot.WriteAsync(FRunSnapshot::GetDefaultPath(), [ArenaIndex](bool bSaved)
+    {
+        UE_LOG(LogTemp, Log, TEXT("RunDirector: Run snapshot for arena %d %s."), ArenaIndex, bSaved ? TEXT("saved") : TEXT("FAILED to save"));
+    });
+}
+
+void URunDirector::DeleteRunSnapshot()
+{
+    bHasResumableRun = false;
+    FRunSnapshot::DeleteAsync(FRunSnapshot::GetDefaultPath());
+}
+
+void URunDirector::PrefetchArenaBundles(int32 Index)
+{
+    const URunArenaData* Data = ArenaSequence.IsValidIndex(Index) ? ArenaSequence[Index] : nullptr;
+    if (!Data || ArenaPrefetches.Contains(Index) || !UAssetManager::IsInitialized())
+    {
+        return;
+    }
+
+    UAssetManager& AssetManager = UAssetManager::Get();
+    const FStreamableDelegate OnLoaded = FStreamableDelegate::CreateUObject(this, &URunDirector::OnArenaBundlesLoaded, Index);
+
+    FRunArenaPrefetch& Prefetch = ArenaPrefetches.Add(Index);
+    Prefetch.AssetId = Data->GetPrimaryAssetId();
+
+    if (AssetManager.GetPrimaryAssetPath(Prefetch.AssetId).IsValid())
+    {
+        const TArray<FName> Bundles = { URunArenaData::EnemiesBundle, URunArenaData::FXBundle, URunArenaData::AudioBundle };
+        Prefetch.Handle = AssetManager.LoadPrimaryAsset(Prefetch.AssetId, Bundles, OnLoaded);
+    }
+    else
+    {
+        // Data asset outside the scanned directories: request its soft references directly
+        TArray<FSoftObjectPath> Paths;
+        for (const TSoftClassPtr<AShooterAICharacter>& Enemy : Data->EnemyArchetypes)
+        {
+            Paths.AddUnique(Enemy.ToSoftObjectPath());
+        }
+        for (const TSoftObjectPtr<UNiagaraSystem>& FX : Data->FXAssets)
+        {
+            Paths.AddUnique(FX.ToSoftObjectPath());
+        }
+        for (const TSoftObjectPtr<USoundBase>& Sound : Data->AudioAssets)
+        {
+            Paths.AddUnique(Sound.ToSoftObjectPath());
+        }
+        Paths.RemoveAll([](const FSoftObjectPath& Path) { return Path.IsNull(); });
+
+        Prefetch.AssetId = FPrimaryAssetId();
+        if (Paths.Num() > 0)
+        {
+            Prefetch.Handle = UAssetManager::GetStreamableManager().RequestAsyncLoad(Paths, OnLoaded);
+        }
+    }
+
+    UE_LOG(LogTemp, Log, TEXT("RunDirector: Prefetching bundles for arena %d (%s)"), Index, *Data->GetName());
+}
+
+void URunDirector::OnArenaBundlesLoaded(int32 Index)
+{
+    FRunArenaPrefetch* Prefetch = ArenaPrefetches.Find(Index);
+    if (!Prefetch || !Prefetch->Handle.IsValid())
+    {
+        return;
+    }
+
+    TArray<UObject*> LoadedAssets;
+    Prefetch->Handle->GetLoadedAssets(LoadedAssets);
+
+    // Classes report almost nothing themselves; count their CDO instead
+    Prefetch->ResourceBytes = 0;
+    for (UObject* Asset : LoadedAssets)
+    {
+        if (const UClass* Class = Cast<UClass>(Asset))
+        {
+            Asset = Class->GetDefaultObject();
+        }
+
+        if (Asset)
+        {
+            Prefetch->ResourceBytes += Asset->GetResourceSizeBytes(EResourceSizeMode::EstimatedTotal);
+        }
+    }
+
+    UE_LOG(LogTemp, Log, TEXT("RunDirector: Arena %d bundles resident (%d assets, %.2f MB, total prefetched %.2f MB)"),
+        Index, LoadedAssets.Num(),
+        Prefetch->ResourceBytes / (1024.0 * 1024.0),
+        GetPrefetchedBytes() / (1024.0 * 1024.0));
+}
+
+void URunDirector::EvictArenaBundlesBefore(int32 Index)
+{
+    TArray<FPrimaryAssetId> EvictedIds;
+
+    for (auto It = ArenaPrefetches.CreateIterator(); It; ++It)
+    {
+        if (It.Key() >= Index)
+        {
+            continue;
+        }
+
+        if (It.Value().Handle.IsValid())
+        {
+            It.Value().Handle->CancelHandle();
+        }
+
+        if (It.Value().AssetId.IsValid())
+        {
+            EvictedIds.Add(It.Value().AssetId);
+        }
+
+        UE_LOG(LogTemp, Log, TEXT("RunDirector: Evicted bundles for arena %d (%.2f MB)"),
+            It.Key(), It.Value().ResourceBytes / (1024.0 * 1024.0));
+
+        It.RemoveCurrent();
+    }
+
+    if (EvictedIds.Num() == 0 || !UAssetManager::IsInitialized())
+    {
+        return;
+    }
+
+    // The same arena data can appear again later in the sequence; keep it if still prefetched
+    for (const TPair<int32, FRunArenaPrefetch>& Pair : ArenaPrefetches)
+    {
+        EvictedIds.Remove(Pair.Value.AssetId);
+    }
+
+    UAssetManager::Get().UnloadPrimaryAssets(EvictedIds);
+}
+
+int64 URunDirector::GetPrefetchedBytes() const
+{
+    int64 Total = 0;
+    for (const TPair<int32, FRunArenaPrefetch>& Pair : ArenaPrefetches)
+    {
+        Total += Pair.Value.ResourceBytes;
+    }
+    return Total;
+}
+
+void URunDirector::OnArenaRewardSpawned(const FGameplayEventData* Payload)
+{
+    if (CurrentArenaData && !CurrentArenaData->bIsFinalArena)
+    {
+        PreloadArena(CurrentArenaIndex + 1);
+    }
+}
+
 void URunDirector::OnArenaCleared(const FGameplayEventData* Payload)
 {
     if (!CurrentArenaData)
@@ -136,6 +698,7 @@ void URunDirector::OnArenaCleared(const FGameplayEventData* Payload)
     if (CurrentArenaData->bIsFinalArena)
     {
         UE_LOG(LogTemp, Log, TEXT("RunDirector: Final arena cleared. Returning to Hub."));
+        DeleteRunSnapshot();
         ReturnToHub();
         return;
     }
@@ -145,12 +708,15 @@ void URunDirector::OnArenaCleared(const FGameplayEventData* Payload)
 
     if (ArenaSequence.IsValidIndex(CurrentArenaIndex))
     {
+        // Checkpoint before moving on: resuming lands at the start of the next arena
+        SaveRunSnapshotAsync();
         LoadArenaByIndex(CurrentArenaIndex);
     }
     else
     {
         // End of sequence, even if not marked final (fallback)
         UE_LOG(LogTemp, Warning, TEXT("RunDirector: Sequence ended but arena was not marked final. Returning to Hub."));
+        DeleteRunSnapshot();
         ReturnToHub();
     }
 }
@@ -160,40 +726,57 @@ void URunDirector::OnArenaLevelLoaded(UWorld* LoadedWorld)
     UE_LOG(LogTemp, Error, TEXT("[DEBUG] OnArenaLevelLoaded fired for world: %s"),
         *LoadedWorld->GetName());
 
-	BindRunEventsToCurrentASC();
-
     if (!LoadedWorld)
         return;
 
-    UE_LOG(LogTemp, Log, TEXT("RunDirector: Arena level loaded. Searching for ArenaManager."));
-
-    for (TActorIterator<AArenaManager> It(LoadedWorld); It; ++It)
+    // Hosted worlds drive every run through UShooterRunHostSubsystem
+    const UShooterRunHostSubsystem* Host = LoadedWorld->GetSubsystem<UShooterRunHostSubsystem>();
+    if (Host && Host->IsHostingRuns())
     {
-        AArenaManager* Manager = *It;
+        return;
+    }
 
-        // Pass current arena data in:
-        if (ArenaSequence.IsValidIndex(CurrentArenaIndex))
-        {
-            Manager->SetCurrentArenaData(ArenaSequence[CurrentArenaIndex]);
-        }
+	BindRunEventsToCurrentASC();
+
+    // Streaming levels belonged to the previous world
+    ActiveArenaStreaming = nullptr;
+    PreloadedArenaStreaming = nullptr;
+    PreloadedArenaIndex = INDEX_NONE;
+
+    if (bAwaitingRunMap)
+    {
+        bAwaitingRunMap = false;
+        LoadArenaByIndex(CurrentArenaIndex);
+        return;
+    }
 
-        Manager->StartArena();
+    if (UsesArenaStreaming())
+    {
         return;
     }
 
-    UE_LOG(LogTemp, Error, TEXT("RunDirector: No ArenaManager found in loaded level."));
+    UE_LOG(LogTemp, Log, TEXT("RunDirector: Arena level loaded. Searching for ArenaManager."));
+
+    StartArenaInLevel(LoadedWorld, nullptr);
 }
 
 void URunDirector::ReturnToHub()
 {
     UE_LOG(LogTemp, Log, TEXT("RunDirector: Opening Hub (L_Hub)."));
 
+    // Whatever ended the run, nothing is left to checkpoint
+    bRunInProgress = false;
+    bAwaitingRunMap = false;
+    ReleaseAllArenaStreaming();
+    EvictArenaBundlesBefore(MAX_int32);
+
     UGameplayStatics::OpenLevel(GetWorld(), FName(TEXT("L_Hub")));
 }
 
 void URunDirector::HandlePlayerDeath()
 {
     UE_LOG(LogTemp, Log, TEXT("RunDirector: Player died. Returning to Hub."));
+    DeleteRunSnapshot();
     ReturnToHub();
 }
 
@@ -216,10 +799,22 @@ void URunDirector::BindRunEventsToCurrentASC()
         return;
     }
 
+    // The same pawn survives streamed arena swaps; bind only once per ASC
+    if (BoundASC.Get() == ASC)
+    {
+        return;
+    }
+
     UE_LOG(LogTemp, Warning, TEXT("RunDirector: Binding Event_Run_ArenaCleared on ASC %s for pawn %s"),
         *GetNameSafe(ASC), *GetNameSafe(PlayerRef));
 
     ASC->GenericGameplayEventCallbacks
         .FindOrAdd(ShooterTags::Event_Run_ArenaCleared)
         .AddUObject(this, &URunDirector::OnArenaCleared);
+
+    ASC->GenericGameplayEventCallbacks
+        .FindOrAdd(ShooterTags::Event_Arena_RewardSpawned)
+        .AddUObject(this, &URunDirector::OnArenaRewardSpawned);
+
+    BoundASC = ASC;
 }
@@ -0,0 +1,154 @@
+#include "Gameplay/Run/RunSnapshot.h"
+
+#include "Async/Async.h"
+#include "HAL/FileManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+#include "Tasks/Pipe.h"
+
+namespace RunSnapshotIO
+{
+    // Every snapshot read/write/delete runs on this pipe, in call order: a delete issued after a
+    // write (run ended right after an arena save) can never be overtaken by it
+    static UE::Tasks::FPipe& GetPipe()
+    {
+        static UE::Tasks::FPipe Pipe(TEXT("RunSnapshotIO"));
+        return Pipe;
+    }
+}
+
+bool FRunSnapshot::operator==(const FRunSnapshot& Other) const
+{
+    return RunIndex == Other.RunIndex
+        && ArenaIndex == Other.ArenaIndex
+        && DifficultyTier == Other.DifficultyTier
+        && RandomSeed == Other.RandomSeed
+        && Health == Other.Health
+        && Stamina == Other.Stamina
+        && Augments == Other.Augments;
+}
+
+bool FRunSnapshot::Serialize(FArchive& Ar)
+{
+    uint32 FileMagic = Magic;
+    uint16 Version = Latest;
+
+    Ar << FileMagic;
+    Ar << Version;
+
+    if (Ar.IsLoading() && (FileMagic != Magic || Version == 0 || Version > Latest))
+    {
+        UE_LOG(LogTemp, Warning, TEXT("RunSnapshot: Rejecting snapshot (Magic=%08x, Version=%d, Latest=%d)"),
+            FileMagic, Version, (int32)Latest);
+        return false;
+    }
+
+    Ar << RunIndex;
+    Ar << ArenaIndex;
+    Ar << DifficultyTier;
+    Ar << RandomSeed;
+    Ar << Health;
+    Ar << Stamina;
+
+    int32 NumAugments = Augments.Num();
+    Ar << NumAugments;
+
+    if (Ar.IsLoading())
+    {
+        // Guard against corrupt counts before allocating
+        if (NumAugments < 0 || NumAugments > 1024)
+        {
+            return false;
+        }
+        Augments.SetNum(NumAugments);
+    }
+
+    for (FRunSnapshotAugment& Augment : Augments)
+    {
+        FName TagName = Augment.AugmentTag.GetTagName();
+        FString EffectPath = Augment.EffectClass.ToString();
+
+        Ar << Augment.DisplayName;
+        Ar << TagName;
+        Ar << EffectPath;
+
+        if (Ar.IsLoading())
+        {
+            Augment.AugmentTag = FGameplayTag::RequestGameplayTag(TagName, false);
+            Augment.EffectClass = FSoftClassPath(EffectPath);
+        }
+    }
+
+    return !Ar.IsError();
+}
+
+bool FRunSnapshot::SaveToBytes(TArray<uint8>& OutBytes) const
+{
+    OutBytes.Reset();
+    FMemoryWriter Writer(OutBytes);
+
+    // Serialize is symmetric; saving does not modify the snapshot
+    return const_cast<FRunSnapshot*>(this)->Serialize(Writer);
+}
+
+bool FRunSnapshot::LoadFromBytes(const TArray<uint8>& Bytes)
+{
+    FMemoryReader Reader(Bytes);
+    return Serialize(Reader);
+}
+
+FString FRunSnapshot::GetDefaultPath()
+{
+    return FPaths::ProjectSavedDir() / TEXT("Run") / TEXT("RunSnapshot.bin");
+}
+
+void FRunSnapshot::WriteAsync(const FString& Path, TFunction<void(bool)> OnComplete) const
+{
+    TArray<uint8> Bytes;
+    if (!SaveToBytes(Bytes))
+    {
+        if (OnComplete)
+        {
+            OnComplete(false);
+        }
+        return;
+    }
+
+    RunSnapshotIO::GetPipe().Launch(UE_SOURCE_LOCATION, [Path, Bytes = MoveTemp(Bytes), OnComplete = MoveTemp(OnComplete)]()
+    {
+        // Write to a temp file then swap, so a crash mid-write never leaves a torn snapshot
+        const FString TempPath = Path + TEXT(".tmp");
+        const bool bSaved = FFileHelper::SaveArrayToFile(Bytes, *TempPath)
+            && IFileManager::Get().Move(*Path, *TempPath, true, true);
+
+        if (OnComplete)
+        {
+            AsyncTask(ENamedThreads::GameThread, [OnComplete, bSaved]() { OnComplete(bSaved); });
+        }
+    });
+}
+
+void FRunSnapshot::ReadAsync(const FString& Path, TFunction<void(bool, const FRunSnapshot&)> OnComplete)
+{
+    RunSnapshotIO::GetPipe().Launch(UE_SOURCE_LOCATION, [Path, OnComplete = MoveTemp(OnComplete)]()
+    {
+        FRunSnapshot Snapshot;
+        TArray<uint8> Bytes;
+        const bool bLoaded = FFileHelper::LoadFileToArray(Bytes, *Path, FILEREAD_Silent) && Snapshot.LoadFromBytes(Bytes);
+
+        AsyncTask(ENamedThreads::GameThread, [OnComplete, bLoaded, Snapshot = MoveTemp(Snapshot)]()
+        {
+            OnComplete(bLoaded, Snapshot);
+        });
+    });
+}
+
+void FRunSnapshot::DeleteAsync(const FString& Path)
+{
+    RunSnapshotIO::GetPipe().Launch(UE_SOURCE_LOCATION, [Path]()
+    {
+        IFileManager::Get().Delete(*Path, false, false, true);
+    });
+}
@@ -0,0 +1,177 @@
+#include "Gameplay/Run/ShooterLoadTestBotController.h"
+#include "Gameplay/Run/ShooterRunHostSubsystem.h"
+#include "Gameplay/Arena/ArenaManager.h"
+#include "Gameplay/Characters/AI/ShooterAICharacter.h"
+#include "Gameplay/Characters/Player/ShooterCharacter.h"
+#include "Gameplay/Interaction/InteractableComponent.h"
+#include "Gameplay/Interaction/InteractableRegistrySubsystem.h"
+#include "Gameplay/Interaction/InteractionFocusComponent.h"
+#include "Gameplay/Tags/ShooterGameplayTags.h"
+
+#include "AbilitySystemComponent.h"
+#include "Engine/World.h"
+#include "Navigation/PathFollowingComponent.h"
+
+AShooterLoadTestBotController::AShooterLoadTestBotController()
+{
+    PrimaryActorTick.bCanEverTick = true;
+    bWantsPlayerState = false;
+}
+
+void AShooterLoadTestBotController::Tick(float DeltaSeconds)
+{
+    Super::Tick(DeltaSeconds);
+
+    const double Now = GetWorld()->GetTimeSeconds();
+    if (Now >= NextThinkTime)
+    {
+        NextThinkTime = Now + ThinkInterval;
+        Think();
+    }
+
+    // No navmesh path: steer straight at the target
+    APawn* Bot = GetPawn();
+    AActor* Target = MoveTarget.Get();
+    if (bSteerDirectly && Bot && Target)
+    {
+        const FVector ToTarget = Target->GetActorLocation() - Bot->GetActorLocation();
+        if (ToTarget.Size2D() > MoveAcceptanceRadius)
+        {
+            Bot->AddMovementInput(ToTarget.GetSafeNormal2D());
+        }
+    }
+}
+
+void AShooterLoadTestBotController::Think()
+{
+    AShooterCharacter* Bot = GetPawn<AShooterCharacter>();
+    if (!Bot || Bot->IsDead())
+    {
+        ClearTarget();
+        return;
+    }
+
+    // Parked until the run's arena has streamed in
+    const UShooterRunHostSubsystem* Host = GetWorld()->GetSubsystem<UShooterRunHostSubsystem>();
+    const AArenaManager* Manager = Host ? Host->GetRunArena(this) : nullptr;
+    if (!Manager)
+    {
+        ClearTarget();
+        return;
+    }
+
+    if (AActor* Enemy = FindEnemy(*Manager, *Bot))
+    {
+        EngageEnemy(*Bot, Enemy);
+        return;
+    }
+
+    const UInteractableRegistrySubsystem* Registry = GetWorld()->GetSubsystem<UInteractableRegistrySubsystem>();
+    if (UInteractableComponent* Interactable = Registry ? Registry->FindNearestInteractable(Bot->GetActorLocation(), InteractableSearchRadius, Bot) : nullptr)
+    {
+        UseInteractable(*Bot, Interactable);
+        return;
+    }
+
+    // Between waves
+    ClearTarget();
+}
+
+AActor* AShooterLoadTestBotController::FindEnemy(const AArenaManager& Manager, const AShooterCharacter& Bot) const
+{
+    AActor* Best = nullptr;
+    float BestDistSq = TNumericLimits<float>::Max();
+
+    for (AShooterAICharacter* Enemy : Manager.GetActiveEnemies())
+    {
+        if (!IsValid(Enemy) || Enemy->IsDead() || Enemy->IsHidden())
+        {
+            continue;
+        }
+
+        const float DistSq = FVector::DistSquared(Enemy->GetActorLocation(), Bot.GetActorLocation());
+        if (DistSq < BestDistSq)
+        {
+            Best = Enemy;
+            BestDistSq = DistSq;
+        }
+    }
+
+    return Best;
+}
+
+void AShooterLoadTestBotController::EngageEnemy(AShooterCharacter& Bot, AActor* Enemy)
+{
+    SetFocus(Enemy);
+
+    const float Distance = FVector::Dist(Bot.GetActorLocation(), Enemy->GetActorLocation());
+    if (Distance > EngageDistance || !LineOfSightTo(Enemy))
+    {
+        MoveTowards(Enemy, EngageDistance * 0.5f);
+        return;
+    }
+
+    // Same activation path as BTTask_AttackTarget
+    if (Bot.HasFireAbilityHandle())
+    {
+        Bot.TryActivateFireAbility();
+    }
+    else
+    {
+        if (UAbilitySystemComponent* ASC = Bot.GetAbilitySystemComponent())
+        {
+            static const FGameplayTagContainer FireTags(ShooterTags::Ability_Weapon_Fire);
+            ASC->TryActivateAbilitiesByTag(FireTags);
+        }
+    }
+}
+
+void AShooterLoadTestBotController::UseInteractable(AShooterCharacter& Bot, UInteractableComponent* Interactable)
+{
+    AActor* Target = Interactable->GetOwner();
+    SetFocus(Target);
+
+    // Stop well inside the reach UAbil_Interact validates against
+    const UInteractionFocusComponent* Focus = Bot.GetInteractionFocus();
+    const float Reach = Focus ? Focus->TraceDistance : 250.f;
+    if (FVector::Dist2D(Bot.GetActorLocation(), Target->GetActorLocation()) > Reach * 0.5f)
+    {
+        MoveTowards(Target, Reach * 0.25f);
+        return;
+    }
+
+    ClearTarget();
+    SetFocus(Target);
+
+    if (UAbilitySystemComponent* ASC = Bot.GetAbilitySystemComponent())
+    {
+        static const FGameplayTagContainer InteractTags(ShooterTags::Ability_Utility_Interact);
+        ASC->TryActivateAbilitiesByTag(InteractTags);
+    }
+}
+
+void AShooterLoadTestBotController::MoveTowards(AActor* NewTarget, float AcceptanceRadius)
+{
+    MoveAcceptanceRadius = AcceptanceRadius;
+
+    // Re-path only for a new target or after the previous move ended
+    if (MoveTarget.Get() == NewTarget && (bSteerDirectly || GetMoveStatus() == EPathFollowingStatus::Moving))
+    {
+        return;
+    }
+
+    MoveTarget = NewTarget;
+    bSteerDirectly = MoveToActor(NewTarget, AcceptanceRadius) == EPathFollowingRequestResult::Failed;
+}
+
+void AShooterLoadTestBotController::ClearTarget()
+{
+    if (MoveTarget.IsValid())
+    {
+        StopMovement();
+    }
+
+    MoveTarget.Reset();
+    bSteerDirectly = false;
+    ClearFocus(EAIFocusPriority::Gameplay);
+}
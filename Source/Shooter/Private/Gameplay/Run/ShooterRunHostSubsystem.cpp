@@ -0,0 +1,643 @@
+#include "Gameplay/Run/ShooterRunHostSubsystem.h"
+#include "Gameplay/Run/RunDirector.h"
+#include "Gameplay/Run/RunArenaData.h"
+#include "Gameplay/Run/ShooterLoadTestBotController.h"
+#include "Gameplay/Arena/ArenaManager.h"
+#include "Gameplay/Characters/AI/ShooterAICharacter.h"
+#include "Gameplay/Characters/Player/ShooterCharacter.h"
+#include "Gameplay/Tags/ShooterGameplayTags.h"
+#include "World/ShooterWorldRegistrySubsystem.h"
+
+#include "AbilitySystemComponent.h"
+#include "AbilitySystemGlobals.h"
+#include "Engine/GameInstance.h"
+#include "Engine/Level.h"
+#include "Engine/LevelStreamingDynamic.h"
+#include "Engine/World.h"
+#include "GameFramework/GameModeBase.h"
+#include "TimerManager.h"
+
+static TAutoConsoleVariable<float> CVarHostArenaSpacing(
+    TEXT("colosseum.Host.ArenaSpacing"),
+    50000.f,
+    TEXT("Distance between the arena instances of hosted runs (must exceed the largest arena)."),
+    ECVF_Cheat);
+
+static TAutoConsoleVariable<int32> CVarHostArenaGridColumns(
+    TEXT("colosseum.Host.ArenaGridColumns"),
+    8,
+    TEXT("Hosted arena instances per grid row."),
+    ECVF_Cheat);
+
+static FAutoConsoleCommandWithWorldAndArgs CmdHostLoadTest(
+    TEXT("colosseum.Host.LoadTest"),
+    TEXT("colosseum.Host.LoadTest <Runs=8> <Seconds=60>: hosts simulated solo runs in this world and logs per-run tick cost."),
+    FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+    {
+        UShooterRunHostSubsystem* Host = World ? World->GetSubsystem<UShooterRunHostSubsystem>() : nullptr;
+        if (!Host)
+        {
+            return;
+        }
+
+        const int32 NumRuns = Args.Num() > 0 ? FCString::Atoi(*Args[0]) : 8;
+        const float Seconds = Args.Num() > 1 ? FCString::Atof(*Args[1]) : 60.f;
+        Host->StartLoadTest(FMath::Max(1, NumRuns), FMath::Max(1.f, Seconds));
+    }));
+
+static FAutoConsoleCommandWithWorld CmdHostReport(
+    TEXT("colosseum.Host.Report"),
+    TEXT("Logs the hosted runs and their measured tick cost so far."),
+    FConsoleCommandWithWorldDelegate::CreateLambda([](UWorld* World)
+    {
+        if (const UShooterRunHostSubsystem* Host = World ? World->GetSubsystem<UShooterRunHostSubsystem>() : nullptr)
+        {
+            Host->LogTickReport();
+        }
+    }));
+
+namespace ShooterRunHost
+{
+    static URunDirector* GetDirector(const UWorld* World)
+    {
+        const UGameInstance* GameInstance = World ? World->GetGameInstance() : nullptr;
+        return GameInstance ? GameInstance->GetSubsystem<URunDirector>() : nullptr;
+    }
+}
+
+void UShooterRunHostSubsystem::Deinitialize()
+{
+    FWorldDelegates::OnWorldTickStart.Remove(TickStartHandle);
+    FWorldDelegates::OnWorldPostActorTick.Remove(PostActorTickHandle);
+
+    for (FShooterHostedRun& Run : Runs)
+    {
+        UnbindRunEvents(Run);
+    }
+    Runs.Empty();
+
+    Super::Deinitialize();
+}
+
+TStatId UShooterRunHostSubsystem::GetStatId() const
+{
+    RETURN_QUICK_DECLARE_CYCLE_STAT(UShooterRunHostSubsystem, STATGROUP_Tickables);
+}
+
+void UShooterRunHostSubsystem::EnableHosting()
+{
+    UWorld* World = GetWorld();
+    if (bHosting || !World)
+    {
+        return;
+    }
+
+    if (World->GetNetMode() == NM_Client)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("ShooterRunHostSubsystem: Clients cannot host runs."));
+        return;
+    }
+
+    bHosting = true;
+
+    TickStartHandle = FWorldDelegates::OnWorldTickStart.AddUObject(this, &UShooterRunHostSubsystem::OnWorldTickStart);
+    PostActorTickHandle = FWorldDelegates::OnWorldPostActorTick.AddUObject(this, &UShooterRunHostSubsystem::OnWorldPostActorTick);
+
+    UE_LOG(LogTemp, Log, TEXT("ShooterRunHostSubsystem: Hosting concurrent runs in %s."), *World->GetName());
+}
+
+FShooterHostedRun* UShooterRunHostSubsystem::FindRun(const AController* Controller)
+{
+    return Runs.FindByPredicate([Controller](const FShooterHostedRun& Run) { return Run.Controller.Get() == Controller; });
+}
+
+AArenaManager* UShooterRunHostSubsystem::GetRunArena(const AController* Controller) const
+{
+    const FShooterHostedRun* Run = Runs.FindByPredicate([Controller](const FShooterHostedRun& Candidate) { return Candidate.Controller.Get() == Controller; });
+    return Run && Run->State == EShooterHostedRunState::InArena ? Run->Manager.Get() : nullptr;
+}
+
+void UShooterRunHostSubsystem::AcquireSlot(FShooterHostedRun& Run)
+{
+    Run.Slot = FreeSlots.Num() > 0 ? FreeSlots.Pop(EAllowShrinking::No) : NextSlot++;
+
+    // Column 0 is left to the persistent map (player starts, hub geometry)
+    const int32 Columns = FMath::Max(1, CVarHostArenaGridColumns.GetValueOnGameThread());
+    const float Spacing = CVarHostArenaSpacing.GetValueOnGameThread();
+    Run.Origin = FVector((Run.Slot % Columns + 1) * Spacing, (Run.Slot / Columns) * Spacing, 0.f);
+}
+
+void UShooterRunHostSubsystem::StartRun(AController* Controller, bool bSimulated)
+{
+    if (!bHosting || !Controller)
+    {
+        return;
+    }
+
+    if (FindRun(Controller))
+    {
+        RestartRun(Controller);
+        return;
+    }
+
+    FShooterHostedRun& Run = Runs.AddDefaulted_GetRef();
+    Run.RunId = NextRunId++;
+    Run.Controller = Controller;
+    Run.Player = Cast<AShooterCharacter>(Controller->GetPawn());
+    Run.bSimulated = bSimulated;
+    Run.RunSeed = FMath::Rand();
+    AcquireSlot(Run);
+
+    UE_LOG(LogTemp, Log, TEXT("ShooterRunHostSubsystem: Run %d started for %s in slot %d%s."),
+        Run.RunId, *GetNameSafe(Controller), Run.Slot, bSimulated ? TEXT(" (simulated)") : TEXT(""));
+
+    BindRunEvents(Run);
+    EnterArena(Run);
+}
+
+void UShooterRunHostSubsystem::RestartRun(AController* Controller)
+{
+    FShooterHostedRun* Run = FindRun(Controller);
+    if (!Run)
+    {
+        StartRun(Controller);
+        return;
+    }
+
+    // The respawned pawn has a new ASC
+    UnbindRunEvents(*Run);
+    Run->Player = Cast<AShooterCharacter>(Controller->GetPawn());
+    Run->ArenaIndex = 0;
+    Run->RunSeed = FMath::Rand();
+
+    UE_LOG(LogTemp, Log, TEXT("ShooterRunHostSubsystem: Run %d restarted for %s."), Run->RunId, *GetNameSafe(Controller));
+
+    BindRunEvents(*Run);
+    EnterArena(*Run);
+}
+
+void UShooterRunHostSubsystem::EndRun(AController* Controller)
+{
+    const int32 Index = Runs.IndexOfByPredicate([Controller](const FShooterHostedRun& Run) { return Run.Controller.Get() == Controller; });
+    if (Index == INDEX_NONE)
+    {
+        return;
+    }
+
+    FShooterHostedRun& Run = Runs[Index];
+    UnbindRunEvents(Run);
+    ReleaseArena(Run);
+    FreeSlots.Add(Run.Slot);
+
+    UE_LOG(LogTemp, Log, TEXT("ShooterRunHostSubsystem: Run %d ended (%d arenas cleared)."), Run.RunId, Run.ArenasCleared);
+
+    if (Run.bSimulated)
+    {
+        if (AShooterCharacter* Player = Run.Player.Get())
+        {
+            Player->Destroy();
+        }
+        if (AController* SimController = Run.Controller.Get())
+        {
+            SimController->Destroy();
+        }
+    }
+
+    Runs.RemoveAt(Index);
+}
+
+void UShooterRunHostSubsystem::EnterArena(FShooterHostedRun& Run)
+{
+    const URunDirector* Director = ShooterRunHost::GetDirector(GetWorld());
+    if (!Director || Director->ArenaSequence.Num() == 0)
+    {
+        // Tick retries once the run director's config has loaded
+        Run.State = EShooterHostedRunState::WaitingForConfig;
+        return;
+    }
+
+    ReleaseArena(Run);
+
+    if (!Director->ArenaSequence.IsValidIndex(Run.ArenaIndex))
+    {
+        Run.ArenaIndex = 0;
+    }
+
+    const URunArenaData* Data = Director->ArenaSequence[Run.ArenaIndex];
+    Run.State = EShooterHostedRunState::InArena;
+
+    if (!Data || Data->ArenaLevel.IsNull())
+    {
+        UE_LOG(LogTemp, Error, TEXT("ShooterRunHostSubsystem: Run %d has no arena level at index %d."), Run.RunId, Run.ArenaIndex);
+        return;
+    }
+
+    FLoadLevelInstanceParams Params(GetWorld(), Data->ArenaLevel.GetLongPackageName(), FTransform(Run.Origin));
+
+    bool bSuccess = false;
+    Run.Streaming = ULevelStreamingDynamic::LoadLevelInstance(Params, bSuccess);
+    if (!bSuccess || !Run.Streaming)
+    {
+        UE_LOG(LogTemp, Error, TEXT("ShooterRunHostSubsystem: Failed to stream '%s' for run %d."),
+            *Data->ArenaLevel.GetLongPackageName(), Run.RunId);
+        Run.Streaming = nullptr;
+        return;
+    }
+
+    Run.State = EShooterHostedRunState::StreamingArena;
+}
+
+void UShooterRunHostSubsystem::StartStreamedArena(FShooterHostedRun& Run)
+{
+    Run.State = EShooterHostedRunState::InArena;
+
+    UWorld* World = GetWorld();
+    const URunDirector* Director = ShooterRunHost::GetDirector(World);
+    const UShooterWorldRegistrySubsystem* Registry = World->GetSubsystem<UShooterWorldRegistrySubsystem>();
+    ULevel* Level = Run.Streaming ? Run.Streaming->GetLoadedLevel() : nullptr;
+
+    AArenaManager* Manager = (Registry && Level) ? Registry->FindArenaManager(Level) : nullptr;
+    if (!Manager || !Director || !Director->ArenaSequence.IsValidIndex(Run.ArenaIndex))
+    {
+        UE_LOG(LogTemp, Error, TEXT("ShooterRunHostSubsystem: No ArenaManager in the arena streamed for run %d."), Run.RunId);
+        return;
+    }
+
+    Run.Manager = Manager;
+
+    AShooterCharacter* Player = Run.Player.Get();
+    if (Player)
+    {
+        const AActor* Entry = Manager->GetPlayerEntryPoint();
+        const FVector Location = Entry ? Entry->GetActorLocation() : Manager->GetActorLocation() + FVector(0.f, 0.f, 200.f);
+        const FRotator Rotation = Entry ? Entry->GetActorRotation() : Manager->GetActorRotation();
+
+        Player->TeleportTo(Location, Rotation);
+        if (AController* Controller = Player->GetController())
+        {
+            Controller->SetControlRotation(Rotation);
+        }
+    }
+
+    URunArenaData* Data = Director->ArenaSequence[Run.ArenaIndex];
+    const int32 Tier = FMath::Max(1, Data ? Data->DifficultyTier : 1) + Run.RunsCompleted;
+
+    Manager->SetCurrentArenaData(Data);
+    Manager->SetArenaPlayer(Player);
+    Manager->SetRunContext(Tier, (int32)HashCombine((uint32)Run.RunSeed, (uint32)Run.ArenaIndex));
+    Manager->StartArena();
+
+    UE_LOG(LogTemp, Log, TEXT("ShooterRunHostSubsystem: Run %d entered arena %d (Tier=%d)."), Run.RunId, Run.ArenaIndex, Tier);
+}
+
+void UShooterRunHostSubsystem::ReleaseArena(FShooterHostedRun& Run)
+{
+    // The manager's EndPlay hands its live enemies back to the shared pool
+    if (ULevelStreamingDynamic* Streaming = Run.Streaming)
+    {
+        Streaming->SetShouldBeVisible(false);
+        Streaming->SetShouldBeLoaded(false);
+        Streaming->SetIsRequestingUnloadAndRemoval(true);
+    }
+
+    Run.Streaming = nullptr;
+    Run.Manager = nullptr;
+}
+
+void UShooterRunHostSubsystem::BindRunEvents(FShooterHostedRun& Run)
+{
+    UAbilitySystemComponent* ASC = UAbilitySystemGlobals::GetAbilitySystemComponentFromActor(Run.Player.Get());
+    if (!ASC || Run.BoundASC.Get() == ASC)
+    {
+        return;
+    }
+
+    Run.ArenaClearedHandle = ASC->GenericGameplayEventCallbacks
+        .FindOrAdd(ShooterTags::Event_Run_ArenaCleared)
+        .AddUObject(this, &UShooterRunHostSubsystem::OnRunArenaCleared, Run.RunId);
+
+    Run.BoundASC = ASC;
+}
+
+void UShooterRunHostSubsystem::UnbindRunEvents(FShooterHostedRun& Run)
+{
+    if (UAbilitySystemComponent* ASC = Run.BoundASC.Get())
+    {
+        ASC->GenericGameplayEventCallbacks
+            .FindOrAdd(ShooterTags::Event_Run_ArenaCleared)
+            .Remove(Run.ArenaClearedHandle);
+    }
+
+    Run.BoundASC = nullptr;
+    Run.ArenaClearedHandle.Reset();
+}
+
+void UShooterRunHostSubsystem::OnRunArenaCleared(const FGameplayEventData* Payload, int32 RunId)
+{
+    FShooterHostedRun* Run = Runs.FindByPredicate([RunId](const FShooterHostedRun& Entry) { return Entry.RunId == RunId; });
+    const URunDirector* Director = ShooterRunHost::GetDirector(GetWorld());
+    if (!Run || !Director || Run->State != EShooterHostedRunState::InArena)
+    {
+        return;
+    }
+
+    ++Run->ArenasCleared;
+
+    const URunArenaData* Data = Director->ArenaSequence.IsValidIndex(Run->ArenaIndex) ? Director->ArenaSequence[Run->ArenaIndex] : nullptr;
+    const bool bRunComplete = !Data || Data->bIsFinalArena || !Director->ArenaSequence.IsValidIndex(Run->ArenaIndex + 1);
+
+    if (bRunComplete)
+    {
+        // Hosted players never return to a hub: the next run starts one tier harder
+        ++Run->RunsCompleted;
+        Run->ArenaIndex = 0;
+        Run->RunSeed = FMath::Rand();
+
+        UE_LOG(LogTemp, Log, TEXT("ShooterRunHostSubsystem: Run %d completed (%d total), starting the next one."), RunId, Run->RunsCompleted);
+    }
+    else
+    {
+        ++Run->ArenaIndex;
+    }
+
+    EnterArena(*Run);
+}
+
+void UShooterRunHostSubsystem::Tick(float DeltaTime)
+{
+    if (!bHosting)
+    {
+        return;
+    }
+
+    URunDirector* Director = ShooterRunHost::GetDirector(GetWorld());
+
+    // Every run draws from the same arenas: keep all of their bundles resident for the whole session
+    if (!bPrefetchedArenas && Director && Director->ArenaSequence.Num() > 0)
+    {
+        for (int32 i = 0; i < Director->ArenaSequence.Num(); ++i)
+        {
+            Director->PrefetchArenaBundles(i);
+        }
+        bPrefetchedArenas = true;
+    }
+
+    for (FShooterHostedRun& Run : Runs)
+    {
+        if (Run.State == EShooterHostedRunState::WaitingForConfig)
+        {
+            EnterArena(Run);
+        }
+        else if (Run.State == EShooterHostedRunState::StreamingArena && Run.Streaming && Run.Streaming->IsLevelVisible())
+        {
+            StartStreamedArena(Run);
+        }
+    }
+}
+
+// --- Tick measurement ---
+
+FShooterRunTickScope::FShooterRunTickScope(const AActor* Actor)
+{
+    const UWorld* World = Actor ? Actor->GetWorld() : nullptr;
+    UShooterRunHostSubsystem* WorldHost = World ? World->GetSubsystem<UShooterRunHostSubsystem>() : nullptr;
+    if (!WorldHost || !WorldHost->IsHostingRuns())
+    {
+        return;
+    }
+
+    RunId = WorldHost->FindRunIdForActor(Actor);
+    if (RunId != INDEX_NONE)
+    {
+        Host = WorldHost;
+        StartTime = FPlatformTime::Seconds();
+    }
+}
+
+FShooterRunTickScope::~FShooterRunTickScope()
+{
+    if (Host)
+    {
+        Host->AddRunTickTime(RunId, (FPlatformTime::Seconds() - StartTime) * 1000.0);
+    }
+}
+
+int32 UShooterRunHostSubsystem::FindRunIdForActor(const AActor* Actor) const
+{
+    const int32* RunId = ActorRunIds.Find(Actor);
+    return RunId ? *RunId : INDEX_NONE;
+}
+
+void UShooterRunHostSubsystem::AddRunTickTime(int32 RunId, double Ms)
+{
+    if (FShooterHostedRun* Run = Runs.FindByPredicate([RunId](const FShooterHostedRun& Entry) { return Entry.RunId == RunId; }))
+    {
+        Run->FrameTickMs += Ms;
+    }
+}
+
+void UShooterRunHostSubsystem::RebuildActorRunIds()
+{
+    ActorRunIds.Reset();
+
+    for (const FShooterHostedRun& Run : Runs)
+    {
+        ActorRunIds.Add(Run.Player.Get(), Run.RunId);
+        ActorRunIds.Add(Run.Controller.Get(), Run.RunId);
+
+        const AArenaManager* Manager = Run.Manager.Get();
+        if (!Manager)
+        {
+            continue;
+        }
+
+        ActorRunIds.Add(Manager, Run.RunId);
+        for (const AShooterAICharacter* Enemy : Manager->GetActiveEnemies())
+        {
+            if (Enemy)
+            {
+                ActorRunIds.Add(Enemy, Run.RunId);
+                ActorRunIds.Add(Enemy->GetController(), Run.RunId);
+            }
+        }
+    }
+
+    // Null players/controllers/enemies would otherwise all map to the last run
+    ActorRunIds.Remove(nullptr);
+}
+
+void UShooterRunHostSubsystem::OnWorldTickStart(UWorld* World, ELevelTick TickType, float DeltaSeconds)
+{
+    if (World != GetWorld())
+    {
+        return;
+    }
+
+    const double Now = FPlatformTime::Seconds();
+    if (LastFrameStartTime > 0.0)
+    {
+        TotalFrameMs += (Now - LastFrameStartTime) * 1000.0;
+    }
+
+    LastFrameStartTime = Now;
+    ActorTickStartTime = Now;
+
+    // Enemies spawn and die between frames
+    RebuildActorRunIds();
+}
+
+void UShooterRunHostSubsystem::OnWorldPostActorTick(UWorld* World, ELevelTick TickType, float DeltaSeconds)
+{
+    if (World != GetWorld() || ActorTickStartTime <= 0.0)
+    {
+        return;
+    }
+
+    const double ActorTickMs = (FPlatformTime::Seconds() - ActorTickStartTime) * 1000.0;
+    ActorTickStartTime = 0.0;
+
+    TotalActorTickMs += ActorTickMs;
+    ++MeasuredFrames;
+
+    double RunsTickMs = 0.0;
+    for (FShooterHostedRun& Run : Runs)
+    {
+        Run.MeasuredTickMs += Run.FrameTickMs;
+        Run.PeakTickMs = FMath::Max(Run.PeakTickMs, Run.FrameTickMs);
+        ++Run.MeasuredFrames;
+
+        RunsTickMs += Run.FrameTickMs;
+        Run.FrameTickMs = 0.0;
+    }
+
+    TotalUnattributedTickMs += FMath::Max(ActorTickMs - RunsTickMs, 0.0);
+}
+
+void UShooterRunHostSubsystem::StartLoadTest(int32 NumRuns, float Seconds)
+{
+    EnableHosting();
+
+    UWorld* World = GetWorld();
+    if (!bHosting || !World)
+    {
+        return;
+    }
+
+    // Fresh measurement window
+    TotalActorTickMs = 0.0;
+    TotalUnattributedTickMs = 0.0;
+    TotalFrameMs = 0.0;
+    MeasuredFrames = 0;
+    LastFrameStartTime = 0.0;
+    for (FShooterHostedRun& Run : Runs)
+    {
+        Run.MeasuredTickMs = 0.0;
+        Run.FrameTickMs = 0.0;
+        Run.PeakTickMs = 0.0;
+        Run.MeasuredFrames = 0;
+    }
+
+    const AGameModeBase* GameMode = World->GetAuthGameMode();
+    UClass* PawnClass = GameMode ? GameMode->DefaultPawnClass.Get() : nullptr;
+    if (!PawnClass || !PawnClass->IsChildOf(AShooterCharacter::StaticClass()))
+    {
+        PawnClass = AShooterCharacter::StaticClass();
+    }
+
+    int32 Started = 0;
+    for (int32 i = 0; i < NumRuns; ++i)
+    {
+        FActorSpawnParameters Params;
+        Params.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+
+        // Parked until the run's first arena has streamed in
+        AShooterCharacter* Pawn = World->SpawnActor<AShooterCharacter>(PawnClass, FTransform(FVector(0.f, 0.f, 1000.f)), Params);
+        if (!Pawn)
+        {
+            continue;
+        }
+
+        // A scripted bot possesses the pawn so its ASC initializes like a player's would, then plays the run
+        FActorSpawnParameters BotParams;
+        BotParams.Instigator = Pawn;
+        BotParams.ObjectFlags |= RF_Transient;
+
+        AShooterLoadTestBotController* Bot = World->SpawnActor<AShooterLoadTestBotController>(Pawn->GetActorLocation(), Pawn->GetActorRotation(), BotParams);
+        if (!Bot)
+        {
+            Pawn->Destroy();
+            continue;
+        }
+
+        Bot->Possess(Pawn);
+        StartRun(Bot, true);
+        ++Started;
+    }
+
+    World->GetTimerManager().SetTimer(LoadTestTimerHandle, this, &UShooterRunHostSubsystem::FinishLoadTest, Seconds, false);
+
+    UE_LOG(LogTemp, Log, TEXT("ShooterRunHostSubsystem: Load test started with %d simulated runs for %.0f s (%d runs hosted)."),
+        Started, Seconds, Runs.Num());
+}
+
+void UShooterRunHostSubsystem::FinishLoadTest()
+{
+    LogTickReport();
+
+    TArray<AController*> Simulated;
+    for (const FShooterHostedRun& Run : Runs)
+    {
+        if (Run.bSimulated && Run.Controller.IsValid())
+        {
+            Simulated.Add(Run.Controller.Get());
+        }
+    }
+
+    for (AController* Controller : Simulated)
+    {
+        EndRun(Controller);
+    }
+
+    // Runs whose controller went away
+    Runs.RemoveAll([this](const FShooterHostedRun& Run)
+    {
+        if (Run.Controller.IsValid())
+        {
+            return false;
+        }
+        FreeSlots.Add(Run.Slot);
+        return true;
+    });
+}
+
+void UShooterRunHostSubsystem::LogTickReport() const
+{
+    if (MeasuredFrames == 0)
+    {
+        UE_LOG(LogTemp, Log, TEXT("ShooterRunHostSubsystem: No frames measured yet (%d runs)."), Runs.Num());
+        return;
+    }
+
+    const double AvgActorTickMs = TotalActorTickMs / MeasuredFrames;
+
+    UE_LOG(LogTemp, Log, TEXT("ShooterRunHostSubsystem: %d runs, %d frames | frame %.2f ms | actor tick %.2f ms (%.2f ms unattributed)"),
+        Runs.Num(), MeasuredFrames,
+        TotalFrameMs / MeasuredFrames,
+        AvgActorTickMs,
+        TotalUnattributedTickMs / MeasuredFrames);
+
+    for (const FShooterHostedRun& Run : Runs)
+    {
+        const AArenaManager* Manager = Run.Manager.Get();
+
+        const FArenaSpawnStats SpawnStats = Manager ? Manager->GetSpawnStats() : FArenaSpawnStats();
+
+        UE_LOG(LogTemp, Log, TEXT("  Run %d (slot %d%s): arena %d, cleared %d, completed %d, enemies %d | avg %.3f ms, peak %.3f ms | spawn queue %d, peak %.2f ms"),
+            Run.RunId, Run.Slot, Run.bSimulated ? TEXT(", simulated") : TEXT(""),
+            Run.ArenaIndex, Run.ArenasCleared, Run.RunsCompleted,
+            Manager ? Manager->GetNumActiveEnemies() : 0,
+            Run.MeasuredFrames > 0 ? Run.MeasuredTickMs / Run.MeasuredFrames : 0.0,
+            Run.PeakTickMs,
+            SpawnStats.QueueDepth, SpawnStats.PeakFrameCostMs);
+    }
+}
@@ -15,6 +15,7 @@ UE_DEFINE_GAMEPLAY_TAG(ShooterTags::Ability_Movement_Slide, "Ability.Movement.Sl
 UE_DEFINE_GAMEPLAY_TAG(ShooterTags::Ability_Movement_Grapple, "Ability.Movement.Grapple");
 
 UE_DEFINE_GAMEPLAY_TAG(ShooterTags::Ability_Weapon_Fire, "Ability.Weapon.Fire");
+UE_DEFINE_GAMEPLAY_TAG(ShooterTags::Ability_Weapon_Melee, "Ability.Weapon.Melee");
 UE_DEFINE_GAMEPLAY_TAG(ShooterTags::Ability_Weapon_Reload, "Ability.Weapon.Reload");
 UE_DEFINE_GAMEPLAY_TAG(ShooterTags::Ability_Weapon_ADS, "Ability.Weapon.ADS");
 UE_DEFINE_GAMEPLAY_TAG(ShooterTags::Ability_Weapon_Switch, "Ability.Weapon.Switch");
@@ -4,6 +4,7 @@
 #include "Components/SKGShooterPawnComponent.h"
 #include "Kismet/KismetSystemLibrary.h"
 #include "Net/UnrealNetwork.h"
+#include "Gameplay/Net/ShooterPushModel.h"
 #include "ShooterPDAFirearm_Old.h"
 #include "Components/SkeletalMeshComponent.h"
 
@@ -17,8 +18,11 @@ AShooterFirearm_Old::AShooterFirearm_Old()
 void AShooterFirearm_Old::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
 {
 	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
-	DOREPLIFETIME(AShooterFirearm_Old, ReloadCounter);
-	DOREPLIFETIME(AShooterFirearm_Old, bHasOwner);	
+
+	FDoRepLifetimeParams Params;
+	Params.bIsPushBased = true;
+	DOREPLIFETIME_WITH_PARAMS_FAST(AShooterFirearm_Old, ReloadCounter, Params);
+	DOREPLIFETIME_WITH_PARAMS_FAST(AShooterFirearm_Old, bHasOwner, Params);
 }
 
 void AShooterFirearm_Old::BeginPlay()
@@ -94,6 +98,7 @@ void AShooterFirearm_Old::SetOwningPawn(APawn* OwningPawn)
 
 	// BP: bHasOwner = IsValid(OwningPawn)
 	bHasOwner = UKismetSystemLibrary::IsValid(OwningPawn);
+	SHOOTER_MARK_DIRTY(AShooterFirearm_Old, bHasOwner, this);
 	OnRep_HasOwner();
 }
 
@@ -108,6 +113,7 @@ void AShooterFirearm_Old::Drop()
 	// BP chain: SetOwner(None) → bHasOwner=false → Detach(KeepWorld,KeepWorld,KeepWorld)
 	SetOwner(nullptr);
 	bHasOwner = false;
+	SHOOTER_MARK_DIRTY(AShooterFirearm_Old, bHasOwner, this);
 	OnRep_HasOwner();
 
 	DetachFromActor(FDetachmentTransformRules::KeepWorldTransform);
@@ -350,6 +356,7 @@ void AShooterFirearm_Old::Server_Reload_Implementation()
 	{
 		ReloadCounter = Next; // true path: set incremented value
 	}
+	SHOOTER_MARK_DIRTY(AShooterFirearm_Old, ReloadCounter, this);
 
 	// Server side: mark state; actual montages usually don’t run on dedicated server
 	bIsReloading = true;
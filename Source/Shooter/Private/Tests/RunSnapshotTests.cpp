@@ -0,0 +1,97 @@
+#include "Gameplay/Run/RunSnapshot.h"
+#include "Gameplay/Tags/ShooterGameplayTags.h"
+
+#include "Math/RandomStream.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRunSnapshotRoundTripTest, "Shooter.Run.Snapshot.RoundTrip",
+    EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FRunSnapshotRoundTripTest::RunTest(const FString& Parameters)
+{
+    // Native tags, so they resolve again on load; the empty tag covers augments without one
+    const FGameplayTag AugmentTags[] = {
+        FGameplayTag(),
+        ShooterTags::Augment_Projectile_Ricochet,
+        ShooterTags::Augment_Mobility_DashChargesUp,
+        ShooterTags::Augment_Sustain_LifeOnKill,
+    };
+
+    FRandomStream Random(0xC0105);
+
+    for (int32 i = 0; i < 64; ++i)
+    {
+        FRunSnapshot Source;
+        Source.RunIndex = Random.RandRange(0, 10000);
+        Source.ArenaIndex = Random.RandRange(0, 32);
+        Source.DifficultyTier = Random.RandRange(1, 10);
+        Source.RandomSeed = Random.GetCurrentSeed();
+        Source.Health = Random.FRandRange(0.f, 500.f);
+        Source.Stamina = Random.FRandRange(0.f, 200.f);
+
+        const int32 NumAugments = Random.RandRange(0, 8);
+        for (int32 a = 0; a < NumAugments; ++a)
+        {
+            FRunSnapshotAugment& Augment = Source.Augments.AddDefaulted_GetRef();
+            Augment.DisplayName = FString::Printf(TEXT("Augment_%d"), Random.RandRange(0, 999));
+            Augment.AugmentTag = AugmentTags[Random.RandRange(0, UE_ARRAY_COUNT(AugmentTags) - 1)];
+            Augment.EffectClass = FSoftClassPath(FString::Printf(TEXT("/Game/Augments/GE_Test_%d.GE_Test_%d_C"), a, a));
+        }
+
+        TArray<uint8> Bytes;
+        FRunSnapshot Loaded;
+        TestTrue(TEXT("Snapshot saves"), Source.SaveToBytes(Bytes));
+        TestTrue(TEXT("Snapshot loads"), Loaded.LoadFromBytes(Bytes));
+        if (!TestTrue(FString::Printf(TEXT("Snapshot %d round-trips"), i), Loaded == Source))
+        {
+            return false;
+        }
+
+        for (int32 a = 0; a < NumAugments; ++a)
+        {
+            TestTrue(FString::Printf(TEXT("Augment tag %s survives the round trip"), *Source.Augments[a].AugmentTag.ToString()),
+                Loaded.Augments[a].AugmentTag == Source.Augments[a].AugmentTag);
+        }
+    }
+
+    return !HasAnyErrors();
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRunSnapshotHeaderTest, "Shooter.Run.Snapshot.Header",
+    EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FRunSnapshotHeaderTest::RunTest(const FString& Parameters)
+{
+    FRunSnapshot Sample;
+    TArray<uint8> Bytes;
+    TestTrue(TEXT("Snapshot saves"), Sample.SaveToBytes(Bytes));
+
+    // Both rejections below log the same warning
+    AddExpectedMessage(TEXT("RunSnapshot: Rejecting snapshot"), ELogVerbosity::Warning, EAutomationExpectedMessageFlags::Contains, 2, false);
+
+    // A newer version must be rejected rather than misread
+    TArray<uint8> FutureVersion = Bytes;
+    FutureVersion[4] = 0xFF;
+    FutureVersion[5] = 0xFF;
+    FRunSnapshot Rejected;
+    TestFalse(TEXT("Future version is rejected"), Rejected.LoadFromBytes(FutureVersion));
+
+    TArray<uint8> BadMagic = Bytes;
+    BadMagic[0] ^= 0xFF;
+    TestFalse(TEXT("Bad magic is rejected"), Rejected.LoadFromBytes(BadMagic));
+
+    // Corrupt augment count, patched right after the fixed-size fields
+    TArray<uint8> BadCount = Bytes;
+    const int32 CountOffset = sizeof(uint32) + sizeof(uint16) + 4 * sizeof(int32) + 2 * sizeof(float);
+    if (TestEqual(TEXT("Augment count follows the fixed fields"), BadCount.Num(), CountOffset + (int32)sizeof(int32)))
+    {
+        BadCount[CountOffset + 3] = 0x7F;
+        TestFalse(TEXT("Corrupt augment count is rejected"), Rejected.LoadFromBytes(BadCount));
+    }
+
+    return !HasAnyErrors();
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
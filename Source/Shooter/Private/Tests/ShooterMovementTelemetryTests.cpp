@@ -0,0 +1,52 @@
+#include "Gameplay/Characters/Player/Movement/ShooterMovementTelemetrySubsystem.h"
+
+#include "GameFramework/CharacterMovementComponent.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FShooterMovementTelemetryHistogramTest, "Shooter.Movement.Telemetry.Histogram",
+    EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FShooterMovementTelemetryHistogramTest::RunTest(const FString& Parameters)
+{
+    // Edges are exclusive upper bounds; the last bucket is open-ended
+    TestEqual(TEXT("Zero distance"), UShooterMovementTelemetrySubsystem::GetDistanceBucket(0.f), 0);
+    TestEqual(TEXT("Just under the first edge"), UShooterMovementTelemetrySubsystem::GetDistanceBucket(0.99f), 0);
+    TestEqual(TEXT("On the first edge"), UShooterMovementTelemetrySubsystem::GetDistanceBucket(1.f), 1);
+    TestEqual(TEXT("Between 25 and 50 cm"), UShooterMovementTelemetrySubsystem::GetDistanceBucket(30.f), 4);
+    TestEqual(TEXT("On the last edge"), UShooterMovementTelemetrySubsystem::GetDistanceBucket(100.f), ShooterMoveTelemetry::NumDistanceBuckets - 1);
+    TestEqual(TEXT("Far past the last edge"), UShooterMovementTelemetrySubsystem::GetDistanceBucket(10000.f), ShooterMoveTelemetry::NumDistanceBuckets - 1);
+
+    const IConsoleVariable* TelemetryVar = IConsoleManager::Get().FindConsoleVariable(TEXT("colosseum.Movement.Telemetry"));
+    if (!TelemetryVar || TelemetryVar->GetInt() == 0)
+    {
+        AddInfo(TEXT("colosseum.Movement.Telemetry is off; skipping the recording check"));
+        return !HasAnyErrors();
+    }
+
+    // A bare movement component (no updated component) is neither walking nor falling
+    UShooterMovementTelemetrySubsystem* Telemetry = NewObject<UShooterMovementTelemetrySubsystem>();
+    const UCharacterMovementComponent* Move = NewObject<UCharacterMovementComponent>();
+
+    Telemetry->RecordServerMove(Move, false, 0.f);
+    Telemetry->RecordServerMove(Move, true, 0.5f);
+    Telemetry->RecordServerMove(Move, true, 30.f);
+
+    const FShooterMoveModeStats& Stats = Telemetry->GetModeStats(EShooterMoveTelemetryMode::Other);
+    TestEqual(TEXT("Server moves"), Stats.ServerMoves, (int64)3);
+    TestEqual(TEXT("Corrections"), Stats.Corrections, (int64)2);
+    TestEqual(TEXT("Total correction distance"), Stats.TotalCorrectionDistance, 30.5, 0.001);
+    TestEqual(TEXT("Max correction distance"), Stats.MaxCorrectionDistance, 30.f);
+    TestEqual(TEXT("Sub-centimeter bucket"), Stats.DistanceHistogram[0], (int64)1);
+    TestEqual(TEXT("25-50 cm bucket"), Stats.DistanceHistogram[4], (int64)1);
+    TestEqual(TEXT("Walking moves"), Telemetry->GetModeStats(EShooterMoveTelemetryMode::Walking).ServerMoves, (int64)0);
+
+    Telemetry->ResetCounters();
+    TestEqual(TEXT("Reset clears the counters"), Telemetry->GetModeStats(EShooterMoveTelemetryMode::Other).ServerMoves, (int64)0);
+
+    return !HasAnyErrors();
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
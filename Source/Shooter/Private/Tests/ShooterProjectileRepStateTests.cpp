@@ -0,0 +1,145 @@
+#include "Gameplay/Combat/Projectile/ShooterProjectileRepState.h"
+
+#include "Math/RandomStream.h"
+#include "Misc/AutomationTest.h"
+#include "UObject/CoreNet.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace ShooterProjectileRepStateTests
+{
+    // Quantization bounds of the encoding (see FShooterProjectileRepState)
+    static constexpr double MaxLocationError = 0.1;      // 0.1 cm grid per axis
+    static constexpr double MaxSpeedError = 0.51;        // whole cm/s
+    static constexpr double MaxDirectionErrorDeg = 0.01; // 16-bit yaw and pitch
+
+    static bool RoundTrip(const FShooterProjectileRepState& Source, FShooterProjectileRepState& OutDecoded, int64& OutNumBits)
+    {
+        FNetBitWriter Writer(nullptr, 512);
+        bool bWriteOk = true;
+        FShooterProjectileRepState(Source).NetSerialize(Writer, nullptr, bWriteOk);
+        OutNumBits = Writer.GetNumBits();
+
+        FNetBitReader Reader(nullptr, Writer.GetData(), Writer.GetNumBits());
+        bool bReadOk = true;
+        OutDecoded.NetSerialize(Reader, nullptr, bReadOk);
+
+        return bWriteOk && bReadOk && !Reader.IsError() && Reader.AtEnd();
+    }
+
+    static double DirectionErrorDeg(const FVector& A, const FVector& B)
+    {
+        const double CosAngle = FVector::DotProduct(A.GetSafeNormal(), B.GetSafeNormal());
+        return FMath::RadiansToDegrees(FMath::Acos(FMath::Clamp(CosAngle, -1.0, 1.0)));
+    }
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FShooterProjectileRepStateRoundTripTest, "Shooter.Net.ProjectileRepState.RoundTrip",
+    EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FShooterProjectileRepStateRoundTripTest::RunTest(const FString& Parameters)
+{
+    using namespace ShooterProjectileRepStateTests;
+
+    FRandomStream Stream(0x5EED);
+    const int32 Samples = 1000;
+
+    for (int32 i = 0; i < Samples; ++i)
+    {
+        FShooterProjectileRepState State;
+        State.bIsActive = true;
+        State.StartLocation = FVector(Stream.FRandRange(-50000.f, 50000.f), Stream.FRandRange(-50000.f, 50000.f), Stream.FRandRange(-2000.f, 5000.f));
+        State.LaunchVelocity = Stream.VRand() * Stream.FRandRange(3000.f, 90000.f);
+        State.LaunchTimeMs = FShooterProjectileRepState::PackTimeMs(Stream.FRandRange(0.f, 3600.f));
+
+        // Half the launches fly flat; the other half carry a gravity scale
+        State.GravityScale = (i % 2 == 0) ? 0.f : Stream.FRandRange(0.05f, 4.f);
+
+        FShooterProjectileRepState Decoded;
+        int64 NumBits = 0;
+        if (!TestTrue(FString::Printf(TEXT("Sample %d decodes"), i), RoundTrip(State, Decoded, NumBits)))
+        {
+            return false;
+        }
+
+        TestTrue(TEXT("Decoded state is active"), Decoded.bIsActive);
+        TestEqual(TEXT("Launch time is exact"), (int32)Decoded.LaunchTimeMs, (int32)State.LaunchTimeMs);
+        TestEqual(TEXT("Gravity scale is exact"), Decoded.GravityScale, State.GravityScale);
+        TestTrue(FString::Printf(TEXT("Sample %d location error within %.2f cm"), i, MaxLocationError),
+            FVector::Dist(Decoded.StartLocation, State.StartLocation) <= MaxLocationError);
+        TestTrue(FString::Printf(TEXT("Sample %d speed error within %.2f cm/s"), i, MaxSpeedError),
+            FMath::Abs(Decoded.LaunchVelocity.Size() - State.LaunchVelocity.Size()) <= MaxSpeedError);
+        TestTrue(FString::Printf(TEXT("Sample %d direction error within %.3f deg"), i, MaxDirectionErrorDeg),
+            DirectionErrorDeg(Decoded.LaunchVelocity, State.LaunchVelocity) <= MaxDirectionErrorDeg);
+    }
+
+    return !HasAnyErrors();
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FShooterProjectileRepStateSizeTest, "Shooter.Net.ProjectileRepState.Size",
+    EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FShooterProjectileRepStateSizeTest::RunTest(const FString& Parameters)
+{
+    using namespace ShooterProjectileRepStateTests;
+
+    // Inactive: the flag only, and decoding resets every other field
+    FShooterProjectileRepState Inactive;
+    Inactive.StartLocation = FVector(100.f, 200.f, 300.f);
+    Inactive.GravityScale = 1.f;
+
+    FShooterProjectileRepState Decoded;
+    Decoded.LaunchTimeMs = 1234;
+    int64 InactiveBits = 0;
+    TestTrue(TEXT("Inactive state decodes"), RoundTrip(Inactive, Decoded, InactiveBits));
+    TestEqual(TEXT("Inactive state is one bit"), InactiveBits, (int64)1);
+    TestFalse(TEXT("Decoded state is inactive"), Decoded.bIsActive);
+    TestEqual(TEXT("Inactive decode resets the launch time"), (int32)Decoded.LaunchTimeMs, 0);
+    TestEqual(TEXT("Inactive decode resets the gravity scale"), Decoded.GravityScale, 0.f);
+
+    // A flat shot pays one bit for the gravity flag, an arcing one the full scale
+    FShooterProjectileRepState Flat;
+    Flat.bIsActive = true;
+    Flat.StartLocation = FVector(1000.f, -2000.f, 150.f);
+    Flat.LaunchVelocity = FVector(30000.f, 0.f, 0.f);
+
+    FShooterProjectileRepState Arcing = Flat;
+    Arcing.GravityScale = 1.f;
+
+    int64 FlatBits = 0;
+    int64 ArcingBits = 0;
+    TestTrue(TEXT("Flat state decodes"), RoundTrip(Flat, Decoded, FlatBits));
+    TestEqual(TEXT("Flat decode has no gravity"), Decoded.GravityScale, 0.f);
+    TestTrue(TEXT("Arcing state decodes"), RoundTrip(Arcing, Decoded, ArcingBits));
+    TestEqual(TEXT("Gravity scale costs 32 bits"), ArcingBits - FlatBits, (int64)32);
+
+    return !HasAnyErrors();
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FShooterProjectileRepStateFlightTimeTest, "Shooter.Net.ProjectileRepState.FlightTime",
+    EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FShooterProjectileRepStateFlightTimeTest::RunTest(const FString& Parameters)
+{
+    FShooterProjectileRepState State;
+    State.bIsActive = true;
+
+    // Launched just before the 16-bit millisecond stamp wraps
+    const double LaunchSeconds = 65.5;
+    State.LaunchTimeMs = FShooterProjectileRepState::PackTimeMs(LaunchSeconds);
+    TestEqual(TEXT("Flight time before the wrap"), State.GetFlightTime(LaunchSeconds + 0.01), 0.01f, 0.0015f);
+    TestEqual(TEXT("Flight time across the wrap"), State.GetFlightTime(LaunchSeconds + 1.25), 1.25f, 0.0015f);
+
+    // Closed-form arc
+    State.StartLocation = FVector(0.f, 0.f, 1000.f);
+    State.LaunchVelocity = FVector(1000.f, 0.f, 0.f);
+    State.GravityScale = 0.5f;
+
+    const FVector Location = State.GetLocationAt(2.f, -980.f);
+    TestEqual(TEXT("Arc X"), Location.X, 2000.0, 0.01);
+    TestEqual(TEXT("Arc Z"), Location.Z, 1000.0 - 0.5 * 980.0 * 0.5 * 4.0, 0.01);
+
+    return !HasAnyErrors();
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
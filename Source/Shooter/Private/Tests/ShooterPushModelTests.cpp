@@ -0,0 +1,61 @@
+#include "Misc/AutomationTest.h"
+#include "Net/UnrealNetwork.h"
+#include "UObject/Class.h"
+#include "UObject/UObjectIterator.h"
+#include "UObject/UnrealType.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FShooterPushModelRegistrationTest, "Shooter.Net.PushModel.Registration",
+    EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FShooterPushModelRegistrationTest::RunTest(const FString& Parameters)
+{
+    // Every replicated property declared in this module must be registered, and registered as push based;
+    // colosseum.Net.ValidatePushModel covers the dirty marks at runtime
+    static const FName ShooterPackage(TEXT("/Script/Shooter"));
+    int32 NumChecked = 0;
+
+    for (TObjectIterator<UClass> It; It; ++It)
+    {
+        UClass* Class = *It;
+        if (Class->GetOutermost()->GetFName() != ShooterPackage || Class->HasAnyClassFlags(CLASS_Deprecated | CLASS_NewerVersionExists))
+        {
+            continue;
+        }
+
+        if (!Class->HasAnyClassFlags(CLASS_ReplicationDataIsSetUp))
+        {
+            Class->SetUpRuntimeReplicationData();
+        }
+
+        TArray<FLifetimeProperty> LifetimeProps;
+        Class->GetDefaultObject()->GetLifetimeReplicatedProps(LifetimeProps);
+
+        for (int32 RepIndex = 0; RepIndex < Class->ClassReps.Num(); ++RepIndex)
+        {
+            const FProperty* Property = Class->ClassReps[RepIndex].Property;
+            if (Property->GetOwnerClass() != Class)
+            {
+                continue;
+            }
+
+            const FLifetimeProperty* Lifetime = LifetimeProps.FindByPredicate([RepIndex](const FLifetimeProperty& Prop)
+            {
+                return Prop.RepIndex == RepIndex;
+            });
+
+            const FString Name = FString::Printf(TEXT("%s.%s"), *Class->GetName(), *Property->GetName());
+            if (TestNotNull(FString::Printf(TEXT("%s is registered in GetLifetimeReplicatedProps"), *Name), Lifetime))
+            {
+                TestTrue(FString::Printf(TEXT("%s is push based"), *Name), Lifetime->bIsPushBased);
+            }
+            ++NumChecked;
+        }
+    }
+
+    TestTrue(TEXT("Found replicated Shooter properties"), NumChecked > 0);
+    return !HasAnyErrors();
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
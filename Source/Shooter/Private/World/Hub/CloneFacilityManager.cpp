@@ -6,11 +6,11 @@
 #include "Gameplay/Run/RunDirector.h"
 #include "Gameplay/Characters/Player/ShooterCharacter.h"
 #include "Gameplay/Tags/ShooterGameplayTags.h"
+#include "World/ShooterWorldRegistrySubsystem.h"
 
 #include "Kismet/GameplayStatics.h"
 #include "AbilitySystemBlueprintLibrary.h"
 #include "GameFramework/CharacterMovementComponent.h"
-#include "EngineUtils.h"
 
 ACloneFacilityManager::ACloneFacilityManager()
 {
@@ -28,18 +28,14 @@ void ACloneFacilityManager::BeginPlay()
         PlayerRef = Cast<AShooterCharacter>(UGameplayStatics::GetPlayerPawn(GetWorld(), 0));
     }
 
-    // If the pod was not set in the editor, try to find one
-    if (!ReprintPod)
+    if (UShooterWorldRegistrySubsystem* Registry = GetWorld()->GetSubsystem<UShooterWorldRegistrySubsystem>())
     {
-        for (TActorIterator<AReprintPodActor> It(GetWorld()); It; ++It)
-        {
-            ReprintPod = *It;
-            break;
-        }
+        Registry->RegisterFacilityManager(this);
     }
 
     // Small delay: ensures pawn, movement, nav, etc. are fully initialized
-    if (ReprintPod && PlayerRef)
+    // (and lets a pod placed later in the level register before we look it up)
+    if (PlayerRef)
     {
         FTimerHandle TmpHandle;
         GetWorldTimerManager().SetTimer(
@@ -52,8 +48,27 @@ void ACloneFacilityManager::BeginPlay()
     }
 }
 
+void ACloneFacilityManager::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    if (UShooterWorldRegistrySubsystem* Registry = GetWorld() ? GetWorld()->GetSubsystem<UShooterWorldRegistrySubsystem>() : nullptr)
+    {
+        Registry->UnregisterFacilityManager(this);
+    }
+
+    Super::EndPlay(EndPlayReason);
+}
+
 void ACloneFacilityManager::BeginReprintSequence()
 {
+    // If the pod was not set in the editor, use the registered one
+    if (!ReprintPod)
+    {
+        if (UShooterWorldRegistrySubsystem* Registry = GetWorld()->GetSubsystem<UShooterWorldRegistrySubsystem>())
+        {
+            ReprintPod = Registry->GetReprintPod();
+        }
+    }
+
     UE_LOG(LogTemp, Log, TEXT("CloneFacility: Starting reprint sequence."));
 
     // Blueprint event for cinematic or cue
@@ -123,12 +138,29 @@ void ACloneFacilityManager::BeginRun()
 
 void ACloneFacilityManager::SaveGenomeData()
 {
-    UE_LOG(LogTemp, Log, TEXT("CloneFacility: Saving genome data stub."));
+    // Run progress is checkpointed by the RunDirector; this forces an extra write
+    URunDirector* RunDirector = GetGameInstance() ? GetGameInstance()->GetSubsystem<URunDirector>() : nullptr;
+    if (!RunDirector || !RunDirector->IsRunInProgress())
+    {
+        UE_LOG(LogTemp, Log, TEXT("CloneFacility: No run in progress to save."));
+        return;
+    }
+
+    UE_LOG(LogTemp, Log, TEXT("CloneFacility: Saving run snapshot."));
+    RunDirector->SaveRunSnapshotAsync();
     // TODO: Save genome or run meta progression here
 }
 
 void ACloneFacilityManager::LoadGenomeData()
 {
-    UE_LOG(LogTemp, Log, TEXT("CloneFacility: Loading genome data stub."));
+    URunDirector* RunDirector = GetGameInstance() ? GetGameInstance()->GetSubsystem<URunDirector>() : nullptr;
+    if (!RunDirector || !RunDirector->HasResumableRun())
+    {
+        UE_LOG(LogTemp, Log, TEXT("CloneFacility: No interrupted run to resume."));
+        return;
+    }
+
+    UE_LOG(LogTemp, Log, TEXT("CloneFacility: Resuming interrupted run."));
+    RunDirector->ResumeRun();
     // TODO: Load genome or player upgrades here
 }
@@ -1,11 +1,11 @@
 #include "World/Hub/CloneStartTerminal.h"
 #include "World/Hub/CloneFacilityManager.h"
 #include "Gameplay/Characters/Player/ShooterCharacter.h"
+#include "World/ShooterWorldRegistrySubsystem.h"
 
 #include "Components/BoxComponent.h"
 #include "Components/StaticMeshComponent.h"
 #include "Components/WidgetComponent.h"
-#include "EngineUtils.h"
 
 ACloneStartTerminal::ACloneStartTerminal()
 {
@@ -27,13 +27,6 @@ void ACloneStartTerminal::BeginPlay()
 {
     Super::BeginPlay();
 
-    // find the facility manager in the level
-    for (TActorIterator<ACloneFacilityManager> It(GetWorld()); It; ++It)
-    {
-        FacilityManagerRef = *It;
-        break;
-    }
-
     if (InteractionZone)
     {
         InteractionZone->OnComponentBeginOverlap.AddDynamic(
@@ -61,6 +54,15 @@ void ACloneStartTerminal::OnInteract(UPrimitiveComponent* OverlappedComp, AActor
 
 void ACloneStartTerminal::BeginRun()
 {
+    // Resolved on use so BeginPlay order between terminal and manager does not matter
+    if (!FacilityManagerRef)
+    {
+        if (UShooterWorldRegistrySubsystem* Registry = GetWorld()->GetSubsystem<UShooterWorldRegistrySubsystem>())
+        {
+            FacilityManagerRef = Registry->GetFacilityManager();
+        }
+    }
+
     if (FacilityManagerRef)
     {
         UE_LOG(LogTemp, Log, TEXT("[CloneStartTerminal] Triggering FacilityManager->BeginRun()."));
@@ -2,6 +2,7 @@
 
 
 #include "World/Hub/ReprintPodActor.h"
+#include "World/ShooterWorldRegistrySubsystem.h"
 #include "Components/StaticMeshComponent.h"
 #include "Components/SceneComponent.h"
 
@@ -16,3 +17,23 @@ AReprintPodActor::AReprintPodActor()
     SpawnPoint = CreateDefaultSubobject<USceneComponent>("SpawnPoint");
     SpawnPoint->SetupAttachment(Root);
 }
+
+void AReprintPodActor::BeginPlay()
+{
+    Super::BeginPlay();
+
+    if (UShooterWorldRegistrySubsystem* Registry = GetWorld()->GetSubsystem<UShooterWorldRegistrySubsystem>())
+    {
+        Registry->RegisterReprintPod(this);
+    }
+}
+
+void AReprintPodActor::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    if (UShooterWorldRegistrySubsystem* Registry = GetWorld() ? GetWorld()->GetSubsystem<UShooterWorldRegistrySubsystem>() : nullptr)
+    {
+        Registry->UnregisterReprintPod(this);
+    }
+
+    Super::EndPlay(EndPlayReason);
+}
@@ -0,0 +1,156 @@
+#include "World/ShooterWorldRegistrySubsystem.h"
+#include "Gameplay/Arena/ArenaManager.h"
+#include "Gameplay/Augments/AugmentPedestal.h"
+#include "World/Hub/CloneFacilityManager.h"
+#include "World/Hub/ReprintPodActor.h"
+
+#include "Engine/Level.h"
+
+void UShooterWorldRegistrySubsystem::Deinitialize()
+{
+    ArenaManagersByLevel.Empty();
+    PedestalsByOwner.Empty();
+    ReprintPod.Reset();
+    FacilityManager.Reset();
+
+    Super::Deinitialize();
+}
+
+void UShooterWorldRegistrySubsystem::RegisterArenaManager(AArenaManager* Manager)
+{
+    if (!Manager)
+    {
+        return;
+    }
+
+    TWeakObjectPtr<AArenaManager>& Slot = ArenaManagersByLevel.FindOrAdd(Manager->GetLevel());
+    if (Slot.IsValid() && Slot.Get() != Manager)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("ShooterWorldRegistry: %s replaces %s as the arena manager of its level"),
+            *Manager->GetName(), *Slot->GetName());
+    }
+
+    Slot = Manager;
+}
+
+void UShooterWorldRegistrySubsystem::UnregisterArenaManager(AArenaManager* Manager)
+{
+    const TObjectKey<ULevel> Key(Manager ? Manager->GetLevel() : nullptr);
+    if (const TWeakObjectPtr<AArenaManager>* Slot = ArenaManagersByLevel.Find(Key))
+    {
+        if (Slot->Get() == Manager || !Slot->IsValid())
+        {
+            ArenaManagersByLevel.Remove(Key);
+        }
+    }
+}
+
+AArenaManager* UShooterWorldRegistrySubsystem::FindArenaManager(const ULevel* Level) const
+{
+    if (Level)
+    {
+        const TWeakObjectPtr<AArenaManager>* Slot = ArenaManagersByLevel.Find(Level);
+        return Slot ? Slot->Get() : nullptr;
+    }
+
+    for (const TPair<TObjectKey<ULevel>, TWeakObjectPtr<AArenaManager>>& Pair : ArenaManagersByLevel)
+    {
+        if (AArenaManager* Manager = Pair.Value.Get())
+        {
+            return Manager;
+        }
+    }
+
+    return nullptr;
+}
+
+void UShooterWorldRegistrySubsystem::GetArenaManagers(TArray<AArenaManager*>& OutManagers) const
+{
+    OutManagers.Reset();
+
+    for (const TPair<TObjectKey<ULevel>, TWeakObjectPtr<AArenaManager>>& Pair : ArenaManagersByLevel)
+    {
+        if (AArenaManager* Manager = Pair.Value.Get())
+        {
+            OutManagers.Add(Manager);
+        }
+    }
+}
+
+void UShooterWorldRegistrySubsystem::RegisterPedestal(AAugmentPedestal* Pedestal)
+{
+    if (Pedestal)
+    {
+        PedestalsByOwner.FindOrAdd(Pedestal->GetOwner()).AddUnique(Pedestal);
+    }
+}
+
+void UShooterWorldRegistrySubsystem::UnregisterPedestal(AAugmentPedestal* Pedestal)
+{
+    if (!Pedestal)
+    {
+        return;
+    }
+
+    const TObjectKey<AActor> Key(Pedestal->GetOwner());
+    if (TArray<TWeakObjectPtr<AAugmentPedestal>>* Pedestals = PedestalsByOwner.Find(Key))
+    {
+        Pedestals->RemoveAllSwap([Pedestal](const TWeakObjectPtr<AAugmentPedestal>& Entry)
+        {
+            return !Entry.IsValid() || Entry.Get() == Pedestal;
+        });
+
+        if (Pedestals->Num() == 0)
+        {
+            PedestalsByOwner.Remove(Key);
+        }
+    }
+}
+
+void UShooterWorldRegistrySubsystem::GetPedestalsOwnedBy(const AActor* OwnerActor, TArray<AAugmentPedestal*>& OutPedestals) const
+{
+    OutPedestals.Reset();
+
+    if (const TArray<TWeakObjectPtr<AAugmentPedestal>>* Pedestals = PedestalsByOwner.Find(OwnerActor))
+    {
+        for (const TWeakObjectPtr<AAugmentPedestal>& Entry : *Pedestals)
+        {
+            if (AAugmentPedestal* Pedestal = Entry.Get())
+            {
+                OutPedestals.Add(Pedestal);
+            }
+        }
+    }
+}
+
+void UShooterWorldRegistrySubsystem::RegisterReprintPod(AReprintPodActor* Pod)
+{
+    if (Pod && !ReprintPod.IsValid())
+    {
+        ReprintPod = Pod;
+    }
+}
+
+void UShooterWorldRegistrySubsystem::UnregisterReprintPod(AReprintPodActor* Pod)
+{
+    if (ReprintPod.Get() == Pod)
+    {
+        ReprintPod.Reset();
+    }
+}
+
+void UShooterWorldRegistrySubsystem::RegisterFacilityManager(ACloneFacilityManager* Manager)
+{
+    if (Manager && !FacilityManager.IsValid())
+    {
+        FacilityManager = Manager;
+    }
+}
+
+void UShooterWorldRegistrySubsystem::UnregisterFacilityManager(ACloneFacilityManager* Manager)
+{
+    if (FacilityManager.Get() == Manager)
+    {
+        FacilityManager.Reset();
+    }
+}
@@ -18,8 +18,18 @@ class SHOOTER_API AShooterAIController : public AAIController
 public:
     AShooterAIController();
 
+    /** Stops the BT and movement while the pawn sits in the enemy pool */
+    void PauseForPool();
+
+    /** Resets blackboard combat flags and restarts the BT for a recycled pawn */
+    void RestartCombatLogic();
+
+    /** Points the blackboard's TargetActor at Target (arena player in hosted runs) */
+    void SetCombatTarget(AActor* Target);
+
 protected:
     virtual void BeginPlay() override;
+    virtual void OnPossess(APawn* InPawn) override;
 
     // Optional configurable delay before first attack (0.51.5s randomized)
     UPROPERTY(EditDefaultsOnly, Category = "Shooter|AI")
@@ -36,4 +46,6 @@ protected:
 
 private:
     void InitializeCombatState();
+
+    AActor* ResolveCombatTarget() const;
 };
@@ -0,0 +1,81 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameFramework/Actor.h"
+#include "Gameplay/AI/Crowd/ShooterCrowdRepState.h"
+#include "ShooterCrowdProxyActor.generated.h"
+
+class UInstancedStaticMeshComponent;
+class UStaticMesh;
+
+/** Server-side input for one crowd entity drawn by a proxy actor */
+struct FShooterCrowdProxyEntity
+{
+    uint32 Id = 0;
+    FVector Position = FVector::ZeroVector;
+    FVector Velocity = FVector::ZeroVector;
+    UStaticMesh* Mesh = nullptr;
+};
+
+/**
+ * Draws the crowd entities of one arena that have not been promoted yet.
+ *
+ * Spawned on the server by UShooterCrowdSubsystem (owned by the arena manager) and replicated as a
+ * quantized FShooterCrowdRepState at colosseum.Crowd.NetUpdateHz; clients extrapolate between updates.
+ * On the server the instances block combat traces so weapons can hit crowd entities, see
+ * UShooterCrowdSubsystem::ApplyHitDamage.
+ */
+UCLASS(NotPlaceable, Transient)
+class SHOOTER_API AShooterCrowdProxyActor : public AActor
+{
+    GENERATED_BODY()
+
+public:
+    AShooterCrowdProxyActor();
+
+    virtual void BeginPlay() override;
+    virtual void Tick(float DeltaSeconds) override;
+    virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
+
+    /** Server: replaces the drawn (and hittable) entities and packs them for clients when due. */
+    void SetEntities(const TArray<FShooterCrowdProxyEntity>& InEntities);
+
+    /** Server: nothing drawn or replicated */
+    bool IsEmpty() const { return RepState.Num() == 0; }
+
+    /** Server: crowd entity id behind a hit on one of this actor's instances. */
+    bool FindEntityId(const FHitResult& Hit, uint32& OutId) const;
+
+protected:
+    UFUNCTION()
+    void OnRep_RepState();
+
+    int32 FindOrAddMesh(UStaticMesh* Mesh);
+    UInstancedStaticMeshComponent* GetOrCreateISM(int32 MeshIndex);
+
+    /** Replaces the instances drawn for Meshes[MeshIndex] with Transforms (world space). */
+    void UpdateInstances(int32 MeshIndex, const TArray<FTransform>& Transforms);
+
+    /** Client: redraws the extrapolated entities */
+    void UpdateClientInstances();
+
+    UPROPERTY(Replicated)
+    TArray<TObjectPtr<UStaticMesh>> Meshes;
+
+    UPROPERTY(ReplicatedUsing = OnRep_RepState)
+    FShooterCrowdRepState RepState;
+
+    /** Parallel to Meshes */
+    UPROPERTY()
+    TArray<TObjectPtr<UInstancedStaticMeshComponent>> MeshComponents;
+
+    /** Server: crowd entity id per instance, parallel to MeshComponents */
+    TArray<TArray<uint32>> InstanceEntityIds;
+
+    /** Client: world-space entities extrapolated from the last received state */
+    TArray<FVector> ClientPositions;
+    TArray<FVector> ClientVelocities;
+    TArray<uint8> ClientMeshIndices;
+
+    double LastPackTime = -1.0;
+};
@@ -0,0 +1,51 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ShooterCrowdRepState.generated.h"
+
+/**
+ * Replicated crowd entities of one arena, sent as one quantized blob by AShooterCrowdProxyActor.
+ *
+ * Clients only draw the crowd, so each entity carries what they need to extrapolate it between updates:
+ *
+ *  - Position relative to the proxy actor as three int16 at PositionStep cm.
+ *  - Horizontal velocity as an 8-bit yaw plus an 8-bit speed at SpeedStep cm/s.
+ *  - 8-bit index into the proxy's replicated mesh list.
+ *
+ * Only Revision is a UPROPERTY, so the net driver compares (and resends) the state once per server pack.
+ */
+USTRUCT()
+struct SHOOTER_API FShooterCrowdRepState
+{
+    GENERATED_BODY()
+
+    static constexpr float PositionStep = 10.f;
+    static constexpr float SpeedStep = 10.f;
+    static constexpr int32 MaxEntities = 4096;
+
+    UPROPERTY()
+    uint32 Revision = 0;
+
+    TArray<FVector> Offsets;
+    TArray<FVector> Velocities;
+    TArray<uint8> MeshIndices;
+
+    int32 Num() const { return Offsets.Num(); }
+
+    void Reset();
+    void Add(const FVector& Offset, const FVector& Velocity, uint8 MeshIndex);
+
+    /** True when both states quantize to the same entities on the wire (Revision aside) */
+    bool SendsSameEntities(const FShooterCrowdRepState& Other) const;
+
+    bool NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess);
+};
+
+template<>
+struct TStructOpsTypeTraits<FShooterCrowdRepState> : public TStructOpsTypeTraitsBase2<FShooterCrowdRepState>
+{
+    enum
+    {
+        WithNetSerializer = true,
+    };
+};
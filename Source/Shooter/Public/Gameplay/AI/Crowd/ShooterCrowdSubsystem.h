@@ -0,0 +1,133 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "UObject/ObjectKey.h"
+#include "ShooterCrowdSubsystem.generated.h"
+
+class AArenaManager;
+class AShooterAICharacter;
+class AShooterCrowdProxyActor;
+class UStaticMesh;
+
+/** Designer entry for fodder enemies that start life as crowd data instead of full actors */
+USTRUCT(BlueprintType)
+struct FArenaCrowdSpawn
+{
+    GENERATED_BODY()
+
+    // Full enemy class spawned when a crowd entity is promoted
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Arena|Crowd")
+    TSubclassOf<AShooterAICharacter> PromotedClass;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Arena|Crowd", meta = (ClampMin = "1"))
+    int32 Count = 20;
+
+    // Cheap instanced mesh drawn while the entity is still crowd data; needs simple collision to be hittable
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Arena|Crowd")
+    TObjectPtr<UStaticMesh> ProxyMesh;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Arena|Crowd")
+    float MoveSpeed = 450.f;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Arena|Crowd")
+    float Health = 50.f;
+};
+
+/** Shared per-archetype data referenced by crowd entities (kept out of the packed arrays) */
+USTRUCT()
+struct FShooterCrowdArchetype
+{
+    GENERATED_BODY()
+
+    UPROPERTY()
+    TSubclassOf<AShooterAICharacter> PromotedClass;
+
+    UPROPERTY()
+    TObjectPtr<UStaticMesh> ProxyMesh;
+};
+
+/** Packed (structure-of-arrays) crowd entity storage. All arrays share one index space. */
+struct FShooterCrowdEntities
+{
+    // Stable across RemoveAtSwap; used to resolve hits on proxy instances
+    TArray<uint32> Ids;
+    TArray<FVector> Positions;
+    TArray<FVector> Velocities;
+    TArray<float> Health;
+    TArray<float> SpawnHealth;
+    TArray<float> MoveSpeed;
+    TArray<int32> Archetype;
+    TArray<uint8> Engaged;
+    TArray<TWeakObjectPtr<AArenaManager>> Owners;
+
+    int32 Num() const { return Positions.Num(); }
+
+    void Add(uint32 Id, const FVector& Position, float InHealth, float InMoveSpeed, int32 InArchetype, AArenaManager* Owner);
+    void RemoveAtSwap(int32 Index);
+    void Reset();
+};
+
+/**
+ * Server-side crowd simulation for low-tier enemies.
+ *
+ * Fodder enemies are stored as packed entity data and moved in one batch per frame.
+ * An entity is promoted to a full AShooterAICharacter (controller, BT, ASC, weapon)
+ * only once it gets within colosseum.Crowd.PromoteDistance of a player or is engaged (shot,
+ * or near a shot entity), with at most colosseum.Crowd.MaxPromotionsPerFrame promotions per frame.
+ *
+ * Each arena's entities are drawn by a replicated AShooterCrowdProxyActor, whose server-side
+ * instances block combat traces; weapons route those hits through ApplyHitDamage.
+ */
+UCLASS()
+class SHOOTER_API UShooterCrowdSubsystem : public UTickableWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    virtual void Deinitialize() override;
+
+    // --- FTickableGameObject ---
+    virtual void Tick(float DeltaTime) override;
+    virtual TStatId GetStatId() const override;
+
+    /** Adds Spawn.Count crowd entities scattered within Radius of Center. Returns the number added. */
+    int32 SpawnCrowd(AArenaManager* Owner, const FArenaCrowdSpawn& Spawn, const FVector& Center, float Radius);
+
+    /** Crowd entities (not yet promoted) belonging to an arena manager */
+    int32 GetNumEntitiesOwnedBy(const AArenaManager* Owner) const;
+
+    int32 GetNumEntities() const { return Entities.Num(); }
+
+    /** Applies area damage to crowd entities. Entities reduced to 0 health are removed without promotion. */
+    int32 DamageEntitiesInRadius(const FVector& Center, float Radius, float Damage);
+
+    /**
+     * Damages the crowd entity behind a hit on a crowd proxy instance and engages the entities within
+     * colosseum.Crowd.EngageRadius of the impact. Returns true when the hit was on a crowd proxy, so the
+     * caller skips its actor damage path (clients and stale hits return true without applying damage).
+     */
+    bool ApplyHitDamage(const FHitResult& Hit, float Damage);
+
+    /** Flags every crowd entity within Radius as engaged so it is promoted regardless of distance. */
+    void EngageEntitiesInRadius(const FVector& Center, float Radius);
+
+    void RemoveEntitiesOwnedBy(const AArenaManager* Owner);
+
+protected:
+    int32 FindOrAddArchetype(const FArenaCrowdSpawn& Spawn);
+    void SimulateEntities(float DeltaTime, const TArray<FVector>& PlayerLocations);
+    void PromoteEntity(int32 Index);
+
+    AShooterCrowdProxyActor* GetOrCreateProxy(AArenaManager* Owner);
+    void UpdateProxies();
+
+    FShooterCrowdEntities Entities;
+    uint32 NextEntityId = 1;
+
+    UPROPERTY()
+    TArray<FShooterCrowdArchetype> Archetypes;
+
+    /** Server: one replicated proxy actor per arena with crowd entities */
+    TMap<TObjectKey<AArenaManager>, TWeakObjectPtr<AShooterCrowdProxyActor>> Proxies;
+};
@@ -6,6 +6,10 @@
 #include "BehaviorTree/Services/BTService_BlackboardBase.h"
 #include "BTService_CheckFlankOrRetreat.generated.h"
 
+/**
+ * Opts the AI into flank/retreat evaluation while this branch is relevant.
+ * The evaluation itself runs batched in UShooterAIDecisionSubsystem.
+ */
 UCLASS()
 class SHOOTER_API UBTService_CheckFlankOrRetreat : public UBTService
 {
@@ -15,5 +19,14 @@ public:
 	UBTService_CheckFlankOrRetreat();
 
 protected:
-	virtual void TickNode(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory, float DeltaSeconds) override;
+	virtual void OnBecomeRelevant(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory) override;
+	virtual void OnCeaseRelevant(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory) override;
+
+	// Health fraction below which the AI starts (and keeps) retreating
+	UPROPERTY(EditAnywhere, Category = "AI", meta = (ClampMin = "0.0", ClampMax = "1.0"))
+	float RetreatHealthPercent = 0.4f;
+
+	// Another enemy within this distance triggers flanking
+	UPROPERTY(EditAnywhere, Category = "AI")
+	float FlankAllyRadius = 800.f;
 };
@@ -6,7 +6,8 @@
 #include "BTService_FaceTarget.generated.h"
 
 /**
- * Forces the AI pawn to face the current TargetActor each tick.
+ * Keeps the AI pawn facing the selected blackboard actor while this branch is relevant.
+ * Facing is computed batched in UShooterAIDecisionSubsystem.
  */
 UCLASS()
 class SHOOTER_API UBTService_FaceTarget : public UBTService_BlackboardBase
@@ -17,5 +18,6 @@ public:
     UBTService_FaceTarget();
 
 protected:
-    virtual void TickNode(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory, float DeltaSeconds) override;
+    virtual void OnBecomeRelevant(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory) override;
+    virtual void OnCeaseRelevant(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory) override;
 };
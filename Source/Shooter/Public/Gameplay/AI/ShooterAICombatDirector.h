@@ -0,0 +1,61 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "UObject/ObjectKey.h"
+#include "ShooterAICombatDirector.generated.h"
+
+class AShooterAICharacter;
+
+/** One registered attacker in the director's schedule (min-heap on NextAttackTime). */
+struct FShooterScheduledAttacker
+{
+    TWeakObjectPtr<AShooterAICharacter> Agent;
+    double NextAttackTime = 0.0;
+
+    bool operator<(const FShooterScheduledAttacker& Other) const
+    {
+        return NextAttackTime < Other.NextAttackTime;
+    }
+};
+
+/**
+ * Server-side combat director for AI enemies.
+ *
+ * Replaces per-enemy looping attack timers with a single time-sliced schedule:
+ *  - Agents register once and are only woken when their next attack is due.
+ *  - At most colosseum.AI.MaxAttacksPerFrame agents are processed per tick.
+ *  - Attack tokens cap how many enemies may attack the same target at the same time, so runs
+ *    hosted side by side (UShooterRunHostSubsystem) do not compete for one shared budget.
+ *  - First attacks are jittered so a wave spawned in one frame does not attack in sync.
+ */
+UCLASS()
+class SHOOTER_API UShooterAICombatDirector : public UTickableWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    virtual void Deinitialize() override;
+
+    // --- FTickableGameObject ---
+    virtual void Tick(float DeltaTime) override;
+    virtual TStatId GetStatId() const override;
+
+    /** Adds an agent to the attack schedule. Safe to call more than once. */
+    void RegisterAttacker(AShooterAICharacter* Agent);
+
+    /** Removes an agent (and any stale entries) from the schedule. */
+    void UnregisterAttacker(AShooterAICharacter* Agent);
+
+    int32 GetNumRegisteredAttackers() const { return Schedule.Num(); }
+    int32 GetNumActiveAttackTokens() const;
+
+protected:
+    void ReleaseExpiredTokens(double Now);
+
+    /** Binary min-heap of attackers ordered by NextAttackTime */
+    TArray<FShooterScheduledAttacker> Schedule;
+
+    /** Per target: world time at which each currently held attack token is returned */
+    TMap<TObjectKey<AActor>, TArray<double>> TokenReleaseTimes;
+};
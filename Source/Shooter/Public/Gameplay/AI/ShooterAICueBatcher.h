@@ -0,0 +1,47 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "GameplayTagContainer.h"
+#include "GameplayEffectTypes.h"
+#include "ShooterAICueBatcher.generated.h"
+
+/** One cosmetic cue waiting for the end-of-frame flush */
+struct FShooterPendingCue
+{
+    TWeakObjectPtr<AActor> Target;
+    FGameplayTag CueTag;
+    FGameplayCueParameters Parameters;
+    float ViewerDistSq = 0.f;
+};
+
+/**
+ * Coalesces and budgets local (non-replicated) AI gameplay cues.
+ *
+ * Cues queued during a frame are flushed once per tick:
+ *  - identical (target, tag) requests collapse into one execution,
+ *  - cues farther than colosseum.Cue.MaxDistance from every local viewer are dropped,
+ *  - at most colosseum.Cue.MaxPerFrame cues run, nearest to a viewer first.
+ * Dedicated servers have no viewers, so nothing is queued there.
+ */
+UCLASS()
+class SHOOTER_API UShooterAICueBatcher : public UTickableWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    virtual void Deinitialize() override;
+
+    // --- FTickableGameObject ---
+    virtual void Tick(float DeltaTime) override;
+    virtual TStatId GetStatId() const override;
+
+    void QueueCue(AActor* Target, const FGameplayTag& CueTag, const FGameplayCueParameters& Parameters = FGameplayCueParameters());
+
+    int32 GetNumPendingCues() const { return PendingCues.Num(); }
+
+protected:
+    void GatherViewerLocations(TArray<FVector>& OutLocations) const;
+
+    TArray<FShooterPendingCue> PendingCues;
+};
@@ -0,0 +1,113 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "ShooterAIDecisionSubsystem.generated.h"
+
+class AAIController;
+class APawn;
+struct FShooterHealthEvent;
+
+/** Decisions an agent has opted into (enabled by BT services while they are relevant) */
+enum class EShooterAIDecision : uint8
+{
+    None = 0,
+    FlankOrRetreat = 1 << 0,
+    FaceTarget = 1 << 1,
+};
+ENUM_CLASS_FLAGS(EShooterAIDecision);
+
+/** Registered agent and the tuning its services supplied */
+struct FShooterAIDecisionAgent
+{
+    TWeakObjectPtr<AAIController> Controller;
+
+    // Pawn whose health is tracked in HealthFractions (valid as a key after the pawn is gone)
+    TObjectKey<APawn> Pawn;
+
+    EShooterAIDecision Decisions = EShooterAIDecision::None;
+    FName FaceTargetKey;
+    float RetreatHealthPercent = 0.4f;
+    float FlankAllyRadius = 800.f;
+};
+
+/** Read-only per-agent snapshot taken on the game thread */
+struct FShooterAIDecisionInput
+{
+    FVector Location = FVector::ZeroVector;
+    FVector FaceTargetLocation = FVector::ZeroVector;
+    float HealthPercent = 1.f;
+    float RetreatHealthPercent = 0.4f;
+    float FlankAllyRadiusSq = 0.f;
+    EShooterAIDecision Decisions = EShooterAIDecision::None;
+    bool bHasFaceTarget = false;
+    bool bWasRetreating = false;
+    bool bWasFlanking = false;
+};
+
+/** Decision results written by worker threads, applied on the game thread */
+struct FShooterAIDecisionOutput
+{
+    FRotator Facing = FRotator::ZeroRotator;
+    bool bApplyFacing = false;
+    bool bRetreating = false;
+    bool bFlanking = false;
+};
+
+/**
+ * Batched AI decision phase (server).
+ *
+ * Once per colosseum.AI.DecisionInterval:
+ *  1. Snapshot agent state (positions, health, targets, blackboard flags) into flat buffers.
+ *  2. Evaluate flank/retreat and facing for every agent with ParallelFor.
+ *  3. Apply blackboard writes, cues and rotations on the game thread, only where state changed.
+ *
+ * UBTService_CheckFlankOrRetreat and UBTService_FaceTarget opt agents in and out of this phase.
+ * Health comes from UShooterCombatEventSubsystem events, cached per pawn, rather than ASC reads.
+ */
+UCLASS()
+class SHOOTER_API UShooterAIDecisionSubsystem : public UTickableWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+    virtual void Deinitialize() override;
+
+    // --- FTickableGameObject ---
+    virtual void Tick(float DeltaTime) override;
+    virtual TStatId GetStatId() const override;
+
+    void EnableFlankOrRetreat(AAIController* Controller, float RetreatHealthPercent, float FlankAllyRadius);
+    void EnableFaceTarget(AAIController* Controller, FName TargetKey);
+    void DisableDecision(AAIController* Controller, EShooterAIDecision Decision);
+
+    int32 GetNumAgents() const { return Agents.Num(); }
+
+protected:
+    FShooterAIDecisionAgent& FindOrAddAgent(AAIController* Controller);
+
+    /** Points the agent at its controller's current pawn and starts tracking that pawn's health */
+    void TrackAgentPawn(FShooterAIDecisionAgent& Agent);
+
+    void GatherSnapshot();
+    void EvaluateDecisions();
+    void ApplyDecisions();
+
+    UFUNCTION()
+    void OnCombatHealthChanged(const FShooterHealthEvent& Event);
+
+    UFUNCTION()
+    void OnCombatHealthDepleted(const FShooterHealthEvent& Event);
+
+    TArray<FShooterAIDecisionAgent> Agents;
+
+    // Flat per-frame buffers, index-aligned with Agents (reused to avoid reallocations)
+    TArray<FShooterAIDecisionInput> Inputs;
+    TArray<FShooterAIDecisionOutput> Outputs;
+
+    float TimeSinceLastDecision = 0.f;
+
+    // Last published health fraction per registered agent pawn; entries live exactly as long as the agent
+    TMap<TObjectKey<APawn>, float> HealthFractions;
+};
@@ -25,34 +25,10 @@ public:
     UPROPERTY(EditDefaultsOnly, Category = "GAS|Effects")
     TSubclassOf<UGameplayEffect> GE_IFrames;
 
-    // Tuning
-    UPROPERTY(EditDefaultsOnly, Category = "Dash")
-    float DashSpeed = 2200.f;
-
-    UPROPERTY(EditDefaultsOnly, Category = "Dash")
-    float DashDuration = 0.20f;
-
+    // Tuning (speed, duration and air dash live on UShooterCharacterMovement_Doom, which simulates the dash)
     UPROPERTY(EditDefaultsOnly, Category = "Dash")
     float IFrameDuration = 0.18f;
 
-    UPROPERTY(EditDefaultsOnly, Category = "Dash|Air")
-    bool bAllowAirDash = true;
-
-    UPROPERTY(EditDefaultsOnly, Category = "Dash|Air", meta = (EditCondition = "bAllowAirDash"))
-    float AirDashSpeedMultiplier = 0.75f;
-
-    UPROPERTY(EditDefaultsOnly, Category = "Dash|Air", meta = (EditCondition = "bAllowAirDash"))
-    float AirDashFallingLateralFriction = 1.0f;
-
-    UPROPERTY(EditDefaultsOnly, Category = "Dash|Air", meta = (EditCondition = "bAllowAirDash"))
-    float AirDashBrakingDecel = 600.f;
-
-    UPROPERTY(EditDefaultsOnly, Category = "Dash|Air", meta = (EditCondition = "bAllowAirDash"))
-    float AirControlDuringAirDash = 0.25f;
-
-    UPROPERTY(EditDefaultsOnly, Category = "Dash|Air", meta = (EditCondition = "bAllowAirDash"))
-    float MaxUpwardVelDuringAirDash = 0.0f;
-
     // Charge vs cooldown (charges expected on character)
     UPROPERTY(EditDefaultsOnly, Category = "Dash|Activation")
     bool bUseCharges = true;
@@ -86,11 +62,22 @@ protected:
         const FGameplayAbilitySpec& Spec) override;
 
 private:
-    // Saved movement to restore
-    float SavedBrakingFriction = -1.f;
-    float SavedFallingLateralFriction = -1.f;
-    float SavedBrakingDecelFalling = -1.f;
-    float SavedAirControl = -1.f;
+    // Dash tuning authored on ability Blueprints before it moved to the movement component (redirected in
+    // DefaultEngine.ini). OnAvatarSet copies values that differ from the unset marker onto the movement component.
+    UPROPERTY(meta = (DeprecatedProperty, DeprecationMessage = "Set DashSpeed on UShooterCharacterMovement_Doom"))
+    float DashSpeed_DEPRECATED = -1.f;
+
+    UPROPERTY(meta = (DeprecatedProperty, DeprecationMessage = "Set DashDuration on UShooterCharacterMovement_Doom"))
+    float DashDuration_DEPRECATED = -1.f;
+
+    // Old default was true, so only a Blueprint that disabled air dash stored a value
+    UPROPERTY(meta = (DeprecatedProperty, DeprecationMessage = "Set bAllowAirDash on UShooterCharacterMovement_Doom"))
+    bool bAllowAirDash_DEPRECATED = true;
+
+    UPROPERTY(meta = (DeprecatedProperty, DeprecationMessage = "Set AirDashSpeedMultiplier on UShooterCharacterMovement_Doom"))
+    float AirDashSpeedMultiplier_DEPRECATED = -1.f;
+
+    void ApplyDeprecatedTuning(const FGameplayAbilityActorInfo* ActorInfo) const;
 
     FTimerHandle EndTimer;
 
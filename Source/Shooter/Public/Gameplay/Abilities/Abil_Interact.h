@@ -6,6 +6,8 @@
 #include "Abilities/GameplayAbility.h"
 #include "Abil_Interact.generated.h"
 
+class UInteractableComponent;
+
 UCLASS()
 class SHOOTER_API UAbil_Interact : public UGameplayAbility
 {
@@ -17,10 +19,6 @@ public:
 
 protected:
 
-    // Maximum distance for interaction line trace
-    UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Interact")
-    float MaxInteractDistance;
-
     // Collision channel used for the trace (usually ECC_Visibility or a custom channel)
     UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Interact")
     TEnumAsByte<ECollisionChannel> TraceChannel;
@@ -52,6 +50,7 @@ protected:
 
 private:
 
-    // Performs the line trace and returns the first interactable actor, if any
-    AActor* FindInteractableActor(const FGameplayAbilityActorInfo* ActorInfo, FHitResult& OutHit) const;
+    // Owning client: the focus component's cached interactable, if within its TraceDistance and usable.
+    // Server and bots: UInteractableRegistrySubsystem::FindNearestInteractable + IsUsableBy, no trace.
+    UInteractableComponent* FindInteractable(const FGameplayAbilityActorInfo* ActorInfo) const;
 };
\ No newline at end of file
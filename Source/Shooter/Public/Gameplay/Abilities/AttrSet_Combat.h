@@ -50,6 +50,10 @@ public:
 	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
 	virtual void PostGameplayEffectExecute(const FGameplayEffectModCallbackData& Data) override;
 
+	// Attributes are push-based; every current/base write marks its property dirty here
+	virtual void PostAttributeChange(const FGameplayAttribute& Attribute, float OldValue, float NewValue) override;
+	virtual void PostAttributeBaseChange(const FGameplayAttribute& Attribute, float OldValue, float NewValue) const override;
+
 protected:
 	UFUNCTION()
 	void OnRep_Health(const FGameplayAttributeData& OldValue) const;
@@ -68,5 +72,7 @@ protected:
 
 protected:
 
+	void MarkAttributeDirty(const FGameplayAttribute& Attribute) const;
+
 	void HandleHealthChanged(float OldValue, float NewValue);
 };
@@ -3,12 +3,15 @@
 #include "CoreMinimal.h"
 #include "GameFramework/Actor.h"
 #include "GameplayTagContainer.h"
+#include "Gameplay/AI/Crowd/ShooterCrowdSubsystem.h"
 #include "ArenaManager.generated.h"
 
 class AShooterAICharacter;
 class AShooterCharacter;
+class AShooterCombatCharacter;
 class AAugmentPedestal;
 class URunArenaData;
+class UArenaWaveGeneratorData;
 
 USTRUCT(BlueprintType)
 struct FArenaWaveData
@@ -19,7 +22,11 @@ struct FArenaWaveData
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Arena|Wave")
     TArray<TSubclassOf<AShooterAICharacter>> EnemyClasses;
 
-    // (Optional) Delay before this wave starts (not yet used here, but useful later)
+    // Fodder enemies simulated as crowd data and promoted to full actors near the player
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Arena|Wave")
+    TArray<FArenaCrowdSpawn> CrowdSpawns;
+
+    // Delay before this wave's enemies start spawning
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Arena|Wave")
     float SpawnDelay = 1.0f;
 
@@ -28,6 +35,32 @@ struct FArenaWaveData
     FGameplayTag BiomeTag;
 };
 
+/** One entry of an arena's spawn queue: a full enemy, or a batch of crowd entities when EnemyClass is null */
+USTRUCT()
+struct FArenaPendingSpawn
+{
+    GENERATED_BODY()
+
+    UPROPERTY()
+    TSubclassOf<AShooterAICharacter> EnemyClass;
+
+    // Count is the batch size
+    UPROPERTY()
+    FArenaCrowdSpawn CrowdBatch;
+};
+
+/** Spawn queue counters of one arena (the STAT_Arena* counters sum every arena in the world) */
+struct FArenaSpawnStats
+{
+    int32 QueueDepth = 0;
+    int32 SpawnsLastFrame = 0;
+    float LastFrameCostMs = 0.f;
+    float PeakFrameCostMs = 0.f;
+    int32 EnemiesSpawned = 0;
+    int32 CrowdEntitiesSpawned = 0;
+    int32 EnemiesPrewarmed = 0;
+};
+
 UCLASS()
 class SHOOTER_API AArenaManager : public AActor
 {
@@ -38,11 +71,17 @@ public:
 
 protected:
     virtual void BeginPlay() override;
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+    virtual void Tick(float DeltaSeconds) override;
 
     // Sequence of waves for this arena (room)
     UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Arena")
     TArray<FArenaWaveData> Waves;
 
+    // When set, StartArena fills wave enemies from this cost table for the run's difficulty tier
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Arena")
+    TObjectPtr<UArenaWaveGeneratorData> WaveGenerator;
+
     // Enemies currently alive in the active wave
     UPROPERTY()
     TArray<AShooterAICharacter*> ActiveEnemies;
@@ -54,13 +93,52 @@ protected:
     UPROPERTY()
     URunArenaData* CurrentArenaData = nullptr;
 
-    // Cached player reference
+    // Player fighting in this arena (assigned by the run host, else the first local player)
     UPROPERTY()
     AShooterCharacter* PlayerRef = nullptr;
 
-    // (Reserved for future use: delayed spawn between waves)
+    // Tier/seed supplied by the run host; otherwise GenerateWaves asks the run director
+    bool bHasRunContext = false;
+    int32 RunContextTier = 1;
+    int32 RunContextSeed = 0;
+
+    // Delays the spawn queue by the wave's SpawnDelay
     FTimerHandle SpawnTimerHandle;
 
+    // Enemies and crowd batches of the current wave still waiting to spawn (drained over several frames by Tick)
+    UPROPERTY()
+    TArray<FArenaPendingSpawn> PendingSpawns;
+
+    // Set by BeginSpawnQueue once the wave's SpawnDelay elapsed; PendingSpawns only drain while open
+    bool bSpawnQueueOpen = false;
+
+    // Pool instances PrewarmEnemyPool still has to park; they use whatever spawn budget the wave leaves
+    UPROPERTY()
+    TArray<TSubclassOf<AShooterAICharacter>> PendingPrewarm;
+
+    // Optional spawn markers; queued enemies rotate through them. Empty = ring around the manager.
+    UPROPERTY(EditInstanceOnly, BlueprintReadOnly, Category = "Arena|Spawning")
+    TArray<TObjectPtr<AActor>> SpawnPoints;
+
+    // Radius of the fallback spawn ring when no SpawnPoints are set
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Arena|Spawning")
+    float SpawnRingRadius = 600.f;
+
+    // Random offset applied around each spawn point so stacked spawns do not overlap
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Arena|Spawning")
+    float SpawnPointJitter = 150.f;
+
+    int32 NextSpawnPointIndex = 0;
+
+    // Simple collision stand-ins for the arena's walls/floor/cover; combat traces only test these
+    // (plus live combatants), skipping decorative meshes. Leave empty to trace the full world.
+    UPROPERTY(EditInstanceOnly, BlueprintReadOnly, Category = "Arena|Collision")
+    TArray<TObjectPtr<AActor>> CombatCollisionProxies;
+
+    // Where the run director places the player when this arena is streamed in
+    UPROPERTY(EditInstanceOnly, BlueprintReadOnly, Category = "Arena")
+    TObjectPtr<AActor> PlayerEntryPoint;
+
     // Augment pedestal Blueprint/Class to spawn as reward
     UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Arena|Rewards")
     TSubclassOf<AAugmentPedestal> AugmentPedestalClass;
@@ -72,9 +150,50 @@ protected:
     // Spawns the three pedestals in front of the manager
     void SpawnArenaPedestals();
 
+    // Replaces wave enemy lists with WaveGenerator output (keeps authored crowd/biome/delay settings)
+    void GenerateWaves();
+
+    // Queues enough pooled enemies for the largest wave of each archetype; parked over frames by ProcessSpawnQueue
+    void PrewarmEnemyPool();
+
+    // Binds death/destroy notifications for an enemy that joined the current wave
+    void TrackEnemy(AShooterAICharacter* Enemy);
+
+    // Hands live enemies of the current wave back to the pool (arena unloaded mid-wave)
+    void ReleaseActiveEnemies();
+
+    // Starts draining PendingSpawns (after SpawnDelay)
+    void BeginSpawnQueue();
+
+    // Spawns queued enemies and crowd batches, then parks queued prewarm instances, until the per-frame budget is used up
+    void ProcessSpawnQueue();
+
+    FArenaSpawnStats SpawnStats;
+
+    // Next staggered spawn transform (round-robin over SpawnPoints or the fallback ring)
+    FTransform GetNextSpawnTransform();
+
+    // Radius around the manager in which crowd entities are scattered
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Arena|Crowd")
+    float CrowdSpawnRadius = 2500.f;
+
 public:
 
     void SetCurrentArenaData(URunArenaData* InData);
+
+    AActor* GetPlayerEntryPoint() const { return PlayerEntryPoint; }
+
+    /** Player this arena's events and enemies target; set before StartArena */
+    void SetArenaPlayer(AShooterCharacter* InPlayer);
+    AShooterCharacter* GetArenaPlayer() const { return PlayerRef; }
+
+    /** Difficulty tier and wave seed for runs not driven by the run director */
+    void SetRunContext(int32 Tier, int32 Seed);
+
+    int32 GetNumActiveEnemies() const { return ActiveEnemies.Num(); }
+    const TArray<AShooterAICharacter*>& GetActiveEnemies() const { return ActiveEnemies; }
+
+    const FArenaSpawnStats& GetSpawnStats() const { return SpawnStats; }
     
     // Entry point called by RunDirector when arena level loads
     UFUNCTION(BlueprintCallable)
@@ -88,6 +207,19 @@ public:
     UFUNCTION()
     void OnEnemyDied(AActor* DeadActor);
 
+    // Bound to AI OnDied events (pooled enemies are recycled, not destroyed)
+    UFUNCTION()
+    void OnEnemyKilled(AShooterCombatCharacter* DeadCharacter);
+
+    // Called by the crowd subsystem when one of this arena's crowd entities becomes a full actor
+    void RegisterPromotedEnemy(AShooterAICharacter* Enemy);
+
+    // Called by the crowd subsystem after crowd entities were promoted or killed
+    void OnCrowdEntitiesRemoved();
+
+    // True when neither actors nor crowd entities of the current wave remain
+    bool IsWaveCleared() const;
+
     // For Blueprint to morph environment between waves
     UFUNCTION(BlueprintImplementableEvent)
     void MorphArenaVisuals();
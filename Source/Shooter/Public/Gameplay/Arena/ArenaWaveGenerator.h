@@ -0,0 +1,76 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/DataAsset.h"
+#include "ArenaWaveGenerator.generated.h"
+
+class AShooterAICharacter;
+struct FArenaWaveData;
+
+/** One enemy archetype's price in the wave generator */
+USTRUCT(BlueprintType)
+struct FArenaEnemyCost
+{
+    GENERATED_BODY()
+
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Wave Generator")
+    TSubclassOf<AShooterAICharacter> EnemyClass;
+
+    // Gameplay threat this enemy contributes toward the wave's target
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Wave Generator", meta = (ClampMin = "0.01"))
+    float ThreatCost = 1.f;
+
+    // Measured server game-thread cost per live instance (ms/frame) from benchmark runs
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Wave Generator", meta = (ClampMin = "0.0"))
+    float ServerCostMs = 0.05f;
+
+    // First difficulty tier this archetype may appear in
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Wave Generator", meta = (ClampMin = "1"))
+    int32 MinTier = 1;
+
+    // Per-wave cap (0 = no cap)
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Wave Generator", meta = (ClampMin = "0"))
+    int32 MaxPerWave = 0;
+
+    // Relative pick chance among affordable archetypes
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Wave Generator", meta = (ClampMin = "0.0"))
+    float Weight = 1.f;
+};
+
+/**
+ * Composes arena waves from a cost table.
+ * Each wave buys enemies until it reaches its threat target for the difficulty tier,
+ * never exceeding the server CPU budget.
+ */
+UCLASS(BlueprintType)
+class SHOOTER_API UArenaWaveGeneratorData : public UDataAsset
+{
+    GENERATED_BODY()
+
+public:
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Wave Generator")
+    TArray<FArenaEnemyCost> CostTable;
+
+    // Threat target = (BaseThreat + ThreatPerTier * (Tier - 1)) * (1 + ThreatGrowthPerWave * WaveIndex)
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Wave Generator")
+    float BaseThreat = 10.f;
+
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Wave Generator")
+    float ThreatPerTier = 5.f;
+
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Wave Generator")
+    float ThreatGrowthPerWave = 0.25f;
+
+    // Summed ServerCostMs a single wave may reach
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Wave Generator", meta = (ClampMin = "0.0"))
+    float ServerBudgetMs = 2.5f;
+
+    // Waves generated when the arena has none authored
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Wave Generator", meta = (ClampMin = "1"))
+    int32 WavesPerArena = 3;
+
+    float GetThreatTarget(int32 DifficultyTier, int32 WaveIndex) const;
+
+    /** Fills OutWave.EnemyClasses (at least the tier's cheapest entry); returns the threat actually bought */
+    float GenerateWave(int32 DifficultyTier, int32 WaveIndex, FRandomStream& Random, FArenaWaveData& OutWave) const;
+};
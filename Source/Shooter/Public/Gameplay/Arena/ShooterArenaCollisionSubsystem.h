@@ -0,0 +1,49 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "UObject/ObjectKey.h"
+#include "ShooterArenaCollisionSubsystem.generated.h"
+
+class AShooterCombatCharacter;
+class UPrimitiveComponent;
+
+/**
+ * Arena-scoped combat collision.
+ *
+ * Arenas register simple collision proxies for their geometry and combatants register while
+ * alive; only those block ShooterCollision::ArenaCombat. Combat traces starting inside a
+ * registered arena's proxy bounds use that channel, so they skip decorative meshes in the
+ * broadphase; traces anywhere else (hub, arenas without proxies) keep their own channel.
+ */
+UCLASS()
+class SHOOTER_API UShooterArenaCollisionSubsystem : public UWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    virtual void Deinitialize() override;
+
+    /** Makes every primitive on the proxy actors block the combat channel */
+    void RegisterArenaProxies(const AActor* Arena, const TArray<AActor*>& ProxyActors);
+    void UnregisterArena(const AActor* Arena);
+
+    void RegisterCombatant(AShooterCombatCharacter* Character);
+    void UnregisterCombatant(AShooterCombatCharacter* Character);
+
+    /** ArenaCombat if TraceStart lies in a registered arena (and colosseum.Collision.ArenaScopedTraces is on), else Fallback */
+    ECollisionChannel GetCombatTraceChannel(const FVector& TraceStart, ECollisionChannel Fallback) const;
+
+protected:
+    struct FArenaProxySet
+    {
+        TArray<TWeakObjectPtr<UPrimitiveComponent>> Primitives;
+
+        // Union of the proxies' bounds, padded by colosseum.Collision.ArenaBoundsPadding
+        FBox Bounds = FBox(ForceInit);
+    };
+
+    static void SetCombatResponse(UPrimitiveComponent* Primitive, bool bBlock);
+
+    TMap<TObjectKey<AActor>, FArenaProxySet> ArenaProxies;
+};
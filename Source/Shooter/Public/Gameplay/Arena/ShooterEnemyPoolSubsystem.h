@@ -0,0 +1,54 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "ShooterEnemyPoolSubsystem.generated.h"
+
+class AShooterAICharacter;
+
+USTRUCT()
+struct FShooterEnemyPoolBucket
+{
+    GENERATED_BODY()
+
+    UPROPERTY()
+    TArray<TObjectPtr<AShooterAICharacter>> Inactive;
+};
+
+/**
+ * Per-archetype pool of arena enemies (server).
+ *
+ * Arenas prewarm the pool one actor at a time under their spawn budget so waves mostly re-activate
+ * parked actors instead of spawning them. Dead pooled enemies come back here when their corpse expires.
+ */
+UCLASS()
+class SHOOTER_API UShooterEnemyPoolSubsystem : public UWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    virtual void Deinitialize() override;
+
+    /** Ensures at least Count parked instances of EnemyClass exist */
+    void PrewarmArchetype(TSubclassOf<AShooterAICharacter> EnemyClass, int32 Count, const FVector& ParkLocation);
+
+    /** Spawns and parks a single instance of EnemyClass (time-sliced prewarm); false if the spawn failed */
+    bool ParkNewEnemy(TSubclassOf<AShooterAICharacter> EnemyClass, const FVector& ParkLocation);
+
+    /**
+     * Returns an activated enemy at SpawnTransform, spawning a new pooled instance if none are free.
+     * CombatTarget is assigned before activation (null = first local player).
+     */
+    AShooterAICharacter* AcquireEnemy(TSubclassOf<AShooterAICharacter> EnemyClass, const FTransform& SpawnTransform, AActor* CombatTarget = nullptr);
+
+    /** Parks Enemy for reuse. Enemies not created by the pool are destroyed instead. */
+    void ReleaseEnemy(AShooterAICharacter* Enemy);
+
+    int32 GetNumInactive(TSubclassOf<AShooterAICharacter> EnemyClass) const;
+
+protected:
+    AShooterAICharacter* SpawnPooledEnemy(TSubclassOf<AShooterAICharacter> EnemyClass, const FTransform& SpawnTransform, AActor* CombatTarget = nullptr);
+
+    UPROPERTY()
+    TMap<TSubclassOf<AShooterAICharacter>, FShooterEnemyPoolBucket> Buckets;
+};
@@ -34,4 +34,9 @@ public:
 
     UFUNCTION(BlueprintCallable)
     void ApplyGEToSelf(TSubclassOf<UGameplayEffect> GEClass);
+
+    const TArray<FAugmentData>& GetAppliedAugments() const { return AppliedAugments; }
+
+    /** Server: forgets applied augments (their effects are removed with the owner's other effects) */
+    void ClearAugments();
 };
@@ -20,6 +20,42 @@ public:
 	/** Tag identifying the AI archetype (e.g. Enemy.Type.Charger / Enemy.Type.Marksman). */
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "AI")
 	FGameplayTag ArchetypeTag;
+
+	// --- Combat director hooks ---
+	/** Seconds between attacks once this agent has attacked (used by UShooterAICombatDirector) */
+	virtual float GetAttackInterval() const { return 1.0f; }
+
+	/** Called by the combat director when this agent's attack is due and a token is free. Returns true if an attack started. */
+	virtual bool PerformScheduledAttack(const AActor* Target) { return false; }
+
+	// --- Pooling (UShooterEnemyPoolSubsystem) ---
+	/** Parks this enemy: hidden, no collision, movement/BT/attack scheduling stopped */
+	void DeactivateForPool();
+
+	/** Brings a parked enemy back at SpawnTransform with full health and a restarted BT */
+	void ActivateFromPool(const FTransform& SpawnTransform);
+
+	bool IsInPool() const { return bInPool; }
+
+	// --- Targeting ---
+	/** Actor this enemy fights (its arena's player); pushed to the controller's blackboard */
+	void SetCombatTarget(AActor* InTarget);
+
+	/** Assigned target, or the first local player when none was assigned */
+	AActor* GetCombatTarget() const;
+
 protected:
     virtual void BeginPlay() override;
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+    virtual void OnCorpseExpired() override;
+
+    void SetCombatParticipation(bool bActive);
+
+    /** Set by the pool for actors it created; their corpses are recycled instead of destroyed */
+    bool bPoolManaged = false;
+    bool bInPool = false;
+
+    TWeakObjectPtr<AActor> CombatTarget;
+
+    friend class UShooterEnemyPoolSubsystem;
 };
@@ -17,9 +17,10 @@ class SHOOTER_API AShooterAI_Charger : public AShooterAICharacter
 public:
     AShooterAI_Charger();
 
-protected:
-    virtual void BeginPlay() override;
+    virtual float GetAttackInterval() const override { return AttackInterval; }
+    virtual bool PerformScheduledAttack(const AActor* Target) override;
 
+protected:
     // Simple melee damage GE
     UPROPERTY(EditDefaultsOnly, Category = "Charger|Combat")
     TSubclassOf<class UGameplayEffect> MeleeDamageEffect;
@@ -31,7 +32,4 @@ protected:
     // Cooldown between melee slams
     UPROPERTY(EditDefaultsOnly, Category = "Charger|Combat")
     float AttackInterval = 1.0f;
-
-    void PerformMeleeAttack();
-    FTimerHandle AttackTimerHandle;
 };
@@ -17,6 +17,9 @@ class SHOOTER_API AShooterAI_Marksman : public AShooterAICharacter
 public:
     AShooterAI_Marksman();
 
+    virtual float GetAttackInterval() const override { return FireInterval; }
+    virtual bool PerformScheduledAttack(const AActor* Target) override;
+
 protected:
     virtual void BeginPlay() override;
 
@@ -27,7 +30,4 @@ protected:
     // Fire interval
     UPROPERTY(EditDefaultsOnly, Category = "Marksman|Combat")
     float FireInterval = 1.2f;
-
-    FTimerHandle FireTimerHandle;
-    void TryRangedAttack();
 };
@@ -5,20 +5,129 @@
 #include "Components/SKGCharacterMovementComponent.h"
 #include "ShooterCharacterMovement_DOOM.generated.h"
 
+/** Custom movement modes (MOVE_Custom sub-modes) */
+UENUM(BlueprintType)
+enum class EShooterCustomMovementMode : uint8
+{
+	None = 0	UMETA(Hidden),
+	Dash = 1,
+};
+
 /**
  * Fast, DOOM-style character movement built on SKG network layer.
  * Emphasizes responsiveness, air control, and snappy jump arcs.
+ *
+ * Dash is a predicted custom movement mode: RequestDash() raises a saved-move flag
+ * (FLAG_Custom_1, sprint stays on FLAG_Custom_0) that starts the dash inside the move itself,
+ * so client replay and the server simulate the same dash from the same inputs. The server only
+ * honours the flag for a remote client after UAbil_Dash has authorized it (AuthorizeServerDash);
+ * an unauthorized flag is dropped and the usual move correction puts the client back.
  */
 UCLASS()
 class SHOOTER_API UShooterCharacterMovement_Doom : public USKGCharacterMovementComponent
 {
 	GENERATED_BODY()
 
+	friend class FSavedMove_ShooterDoom;
+
 public:
 	UShooterCharacterMovement_Doom();
 
+	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
+	virtual FNetworkPredictionData_Client* GetPredictionData_Client() const override;
+	virtual void UpdateFromCompressedFlags(uint8 Flags) override;
+
+	/** Starts a dash on the next movement update (call on the locally controlled side only) */
+	void RequestDash() { bWantsToDash = true; }
+
+	/** Server: lets the next dash flag from the owning client start a dash (after the dash ability committed) */
+	void AuthorizeServerDash();
+
+	UFUNCTION(BlueprintPure, Category = "Dash")
+	bool IsDashing() const;
+
+	float GetDashDuration() const { return DashDuration; }
+
+	/**
+	 * Opens/closes a correction telemetry window on the server (colosseum.Movement.CorrectionTest).
+	 * Compiled out of Shipping; the server ignores callers without cheats who are not the listen-server host.
+	 */
+	UFUNCTION(Server, Reliable)
+	void ServerSetCorrectionTestActive(bool bActive);
+
+	// --- Dash tuning (movement owns it so prediction and server agree) ---
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Dash")
+	float DashSpeed = 2200.f;
+
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Dash")
+	float DashDuration = 0.20f;
+
+	// Horizontal speed kept when the dash ends
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Dash")
+	float DashExitSpeed = 850.f;
+
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Dash|Air")
+	bool bAllowAirDash = true;
+
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Dash|Air", meta = (EditCondition = "bAllowAirDash"))
+	float AirDashSpeedMultiplier = 0.75f;
+
 protected:
 	virtual void BeginPlay() override;
 	virtual void PhysFalling(float DeltaTime, int32 Iterations) override;
+	virtual void PhysCustom(float DeltaTime, int32 Iterations) override;
 	virtual float GetMaxSpeed() const override;
+	virtual void UpdateCharacterStateBeforeMovement(float DeltaSeconds) override;
+
+	/** Feeds UShooterMovementTelemetrySubsystem with every checked client move and its correction */
+	virtual void ServerMoveHandleClientError(float ClientTimeStamp, float DeltaTime, const FVector& Accel, const FVector& RelativeClientLocation,
+		UPrimitiveComponent* ClientMovementBase, FName ClientBaseBoneName, uint8 ClientMovementMode) override;
+
+	bool CanStartDash() const;
+	/** Server: true when a remote client's dash flag is backed by an ability activation; consumes it */
+	bool ConsumeServerDashAuthorization();
+	void StartDash();
+	void PhysDash(float DeltaTime, int32 Iterations);
+	void EndDash();
+
+	// Input flag, replicated through the saved move's compressed flags
+	bool bWantsToDash = false;
+
+	// Dash state, restored from the saved move before each client replay
+	float DashTimeRemaining = 0.f;
+	FVector DashVelocity = FVector::ZeroVector;
+	bool bDashStartedOnGround = false;
+
+	// Server: world time until which one remote dash flag is honoured (< 0 when none is pending)
+	double ServerDashAuthorizedUntil = -1.0;
+};
+
+class FSavedMove_ShooterDoom : public FSavedMove_Character
+{
+public:
+	typedef FSavedMove_Character Super;
+
+	virtual bool CanCombineWith(const FSavedMovePtr& NewMove, ACharacter* InCharacter, float MaxDelta) const override;
+	virtual void Clear() override;
+	virtual void SetMoveFor(ACharacter* C, float InDeltaTime, FVector const& NewAccel, class FNetworkPredictionData_Client_Character& ClientData) override;
+	virtual void PrepMoveFor(ACharacter* C) override;
+	virtual uint8 GetCompressedFlags() const override;
+
+	// SKG's saved move is module-private, so sprint is carried here as well (same flag bit)
+	bool bSavedWantsToSprint = false;
+	bool bSavedWantsToDash = false;
+
+	float SavedDashTimeRemaining = 0.f;
+	FVector SavedDashVelocity = FVector::ZeroVector;
+	bool bSavedDashStartedOnGround = false;
+};
+
+class FNetworkPredictionData_Client_ShooterDoom : public FNetworkPredictionData_Client_Character
+{
+public:
+	typedef FNetworkPredictionData_Client_Character Super;
+
+	FNetworkPredictionData_Client_ShooterDoom(const UCharacterMovementComponent& ClientMovement);
+
+	virtual FSavedMovePtr AllocateNewMove() override;
 };
@@ -0,0 +1,101 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "ShooterMovementTelemetrySubsystem.generated.h"
+
+class ACharacter;
+class UCharacterMovementComponent;
+
+/** Movement mode buckets (server mode when the client move was checked) */
+enum class EShooterMoveTelemetryMode : uint8
+{
+    Walking,
+    Falling,
+    Dash,
+    Other,
+    Num
+};
+
+/** Upper edges (cm) of the corrected-distance histogram; the last bucket is open-ended */
+namespace ShooterMoveTelemetry
+{
+    static constexpr int32 NumDistanceBuckets = 7;
+    static constexpr float DistanceBucketEdges[NumDistanceBuckets - 1] = { 1.f, 5.f, 10.f, 25.f, 50.f, 100.f };
+}
+
+struct FShooterMoveModeStats
+{
+    int64 ServerMoves = 0;
+    int64 Corrections = 0;
+    double TotalCorrectionDistance = 0.0;
+    float MaxCorrectionDistance = 0.f;
+    int64 DistanceHistogram[ShooterMoveTelemetry::NumDistanceBuckets] = {};
+};
+
+/**
+ * Counts server-side movement corrections (ServerMoveHandleClientError) per movement mode,
+ * with a corrected-distance histogram.
+ *
+ *  - Live: stat ShooterMovement, Insights counters (ShooterMovement/*) and the CSV profiler category ShooterMovement.
+ *  - colosseum.Movement.TelemetryReport logs the totals and writes Saved/Profiling/MovementTelemetry_*.csv.
+ *  - colosseum.Movement.CorrectionTest <Seconds> <LagMs> <LossPct> (run on a connected client, e.g. a -nullrhi
+ *    client with -ExecCmds) enables net emulation, drives the local pawn through scripted walk/sprint/jump/dash
+ *    input and has the server report the window. It is a manual measurement, not an automation test: nothing
+ *    asserts on the correction counts.
+ */
+UCLASS()
+class SHOOTER_API UShooterMovementTelemetrySubsystem : public UTickableWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    // --- FTickableGameObject ---
+    virtual void Tick(float DeltaTime) override;
+    virtual TStatId GetStatId() const override;
+
+    /** Called by the movement component for every client move the server checked */
+    void RecordServerMove(const UCharacterMovementComponent* Move, bool bCorrected, float CorrectionDistance);
+
+    void ResetCounters();
+
+    void LogReport() const;
+
+    /** Writes per-mode totals and histograms; returns the file path (empty on failure) */
+    FString WriteCsv() const;
+
+    /** Client side of the correction test; see class comment */
+    void StartCorrectionTest(float Seconds, int32 LagMs, float LossPercent);
+
+    bool IsCorrectionTestRunning() const { return bCorrectionTestRunning; }
+
+    /** Histogram bucket of a corrected distance (see ShooterMoveTelemetry::DistanceBucketEdges) */
+    static int32 GetDistanceBucket(float Distance);
+
+    const FShooterMoveModeStats& GetModeStats(EShooterMoveTelemetryMode Mode) const { return ModeStats[(int32)Mode]; }
+
+protected:
+    static EShooterMoveTelemetryMode GetTelemetryMode(const UCharacterMovementComponent* Move);
+
+    void TickCorrectionTest(float DeltaTime);
+    void FinishCorrectionTest();
+    void SetNetEmulation(int32 LagMs, float LossPercent);
+
+    FShooterMoveModeStats ModeStats[(int32)EShooterMoveTelemetryMode::Num];
+
+    double WindowStartTime = 0.0;
+
+    // --- Correction test (client) ---
+    bool bCorrectionTestRunning = false;
+    float TestElapsed = 0.f;
+    float TestDuration = 0.f;
+    float NextJumpTime = 0.f;
+    float NextDashTime = 0.f;
+    bool bJumpHeld = false;
+
+    // Net emulation values to restore afterwards
+    FString SavedPktLag;
+    FString SavedPktLoss;
+
+    TWeakObjectPtr<ACharacter> TestPawn;
+};
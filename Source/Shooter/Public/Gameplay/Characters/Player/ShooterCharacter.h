@@ -10,10 +10,29 @@ class UGameplayEffect;
 class UCameraComponent;
 class USpringArmComponent;
 class UAugmentManagerComponent;
+class UInteractionFocusComponent;
 class AShooterWeaponBase;
 class AActor;
 struct FInputActionValue;
 
+/**
+ * Dash charges as of the last consume; current charges are derived from it and the synced server clock,
+ * so recharging needs no timers and replicates nothing.
+ */
+USTRUCT()
+struct FShooterDashChargeState
+{
+	GENERATED_BODY()
+
+	// Server world time of the last consume
+	UPROPERTY()
+	double LastConsumeTime = -1.0e9;
+
+	// Charges missing right after that consume
+	UPROPERTY()
+	uint8 ChargesUsed = 0;
+};
+
 /**
  * Player-controlled shooter character.
  * Extends AShooterCombatCharacter with:
@@ -43,6 +62,8 @@ public:
 
 	AActor* PerformInteractionTrace(float Distance, FHitResult& OutHit);
 
+	UInteractionFocusComponent* GetInteractionFocus() const { return InteractionFocus; }
+
 	// --- Camera ---
 	UFUNCTION(BlueprintCallable, Category = "Shooter|Camera")
 	void SetUseThirdPersonCamera(bool bEnable);
@@ -52,24 +73,29 @@ public:
 
 	// --- Dash API ---
 	UFUNCTION(BlueprintPure, Category = "Shooter|Dash|Charges")
-	int32 GetCurrentDashCharges() const { return CurrentDashCharges; }
+	int32 GetCurrentDashCharges() const;
 
 	UFUNCTION(BlueprintPure, Category = "Shooter|Dash|Charges")
 	int32 GetMaxDashCharges() const { return MaxDashCharges; }
 
 	UFUNCTION(BlueprintPure, Category = "Shooter|Dash|Charges")
-	bool HasDashCharge() const { return CurrentDashCharges > 0; }
+	bool HasDashCharge() const { return GetCurrentDashCharges() > 0; }
 
+	/** Consumes a charge; on the owning client this predicts the server's consume */
 	bool ConsumeDashCharge();
-	void EnsureDashRechargeRunning();
-	void AddDashChargeLocal(int32 Delta)
-	{
-		CurrentDashCharges = FMath::Clamp(CurrentDashCharges + Delta, 0, MaxDashCharges);
-	}
+
+	/** Undoes a predicted consume locally (the server never consumed it) */
+	void AddDashChargeLocal(int32 Delta);
 
 	UFUNCTION(BlueprintPure, Category = "Shooter|GAS")
 	bool IsInIFrame() const;
 
+	/**
+	 * Server: brings this dead pawn back at SpawnTransform without respawning it. Resets attributes,
+	 * effects, tags, abilities, augments, dash charges, ragdoll and movement; ASC, components and weapon stay.
+	 */
+	void ReviveAt(const FTransform& SpawnTransform);
+
 	/** Debug: Apply self-damage via GAS for testing death/respawn */
 	UFUNCTION(BlueprintCallable, Category = "Shooter|Debug")
 	void Debug_ApplySelfDamage();
@@ -82,11 +108,9 @@ protected:
 	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
 	virtual void Landed(const FHitResult& Hit) override;
 	virtual void HandleDeath() override;
+	virtual void ResetDeathState() override;
 	
 	// --- Abilities ---
-	UPROPERTY(EditDefaultsOnly, Category = "Shooter|Abilities")
-	TSubclassOf<UGameplayAbility> DashAbilityClass;
-
 	UPROPERTY(EditDefaultsOnly, Category = "Shooter|Abilities")
 	TSubclassOf<UGameplayAbility> InteractAbilityClass;
 
@@ -101,11 +125,9 @@ protected:
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Shooter|Dash")
 	int32 MaxDashCharges = 2;
 
-	UPROPERTY(VisibleInstanceOnly, BlueprintReadOnly, Category = "Shooter|Dash")
-	int32 CurrentDashCharges = 2;
-
+	// Written on consume only (server, and predicted on the owning client)
 	UPROPERTY(ReplicatedUsing = OnRep_DashCharges)
-	int32 Rep_CurrentDashCharges = 2;
+	FShooterDashChargeState DashChargeState;
 
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Shooter|Dash")
 	bool bRefillAllAtOnce = true;
@@ -119,14 +141,18 @@ protected:
 	UFUNCTION()
 	void OnRep_DashCharges();
 
-	FTimerHandle DashRechargeTimer;
-	void DashRechargeTick_PerCharge();
-	void OnRefillAllTimer();
+	/** Server world time (synced on clients) used for charge timestamps */
+	double GetDashClockSeconds() const;
+	int32 GetDashChargesAt(double Time) const;
 
 	// --- Augment System ---
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Augments", meta = (AllowPrivateAccess = "true"))
 	UAugmentManagerComponent* AugmentManager;
 
+	// --- Interaction ---
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Shooter|Interact")
+	TObjectPtr<UInteractionFocusComponent> InteractionFocus;
+
 	// --- Camera ---
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Shooter|Camera")
 	TObjectPtr<UCameraComponent> FirstPersonCamera;
@@ -4,6 +4,7 @@
 #include "GameFramework/Character.h"
 #include "AbilitySystemInterface.h"
 #include "GameplayTagContainer.h"
+#include "GameplayAbilitySpecHandle.h"
 #include "ShooterCombatCharacter.generated.h"
 
 // Forward declarations
@@ -12,6 +13,10 @@ class UAttrSet_Combat;
 class AShooterWeaponBase;
 class USKGShooterPawnComponent;
 class UGameplayAbility;
+class AShooterCombatCharacter;
+struct FOnAttributeChangeData;
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FShooterCharacterDiedSignature, AShooterCombatCharacter*, DeadCharacter);
 
 /**
  * Base combat-capable character (used by both Player and AI)
@@ -59,6 +64,19 @@ protected:
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "GAS|Abilities")
 	TSubclassOf<UGameplayAbility> FireWeaponAbilityClass;
 
+	/** Optional dedicated melee ability. Melee archetypes fall back to Fire when unset. */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "GAS|Abilities")
+	TSubclassOf<UGameplayAbility> MeleeAbilityClass;
+
+	/** Dash ability (player dash, optional AI evade) */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "GAS|Abilities")
+	TSubclassOf<UGameplayAbility> DashAbilityClass;
+
+	// Spec handles cached at grant time (server) so activation skips tag lookups and spec scans
+	FGameplayAbilitySpecHandle FireAbilityHandle;
+	FGameplayAbilitySpecHandle MeleeAbilityHandle;
+	FGameplayAbilitySpecHandle DashAbilityHandle;
+
 	/** Flag to ensure abilities arent granted twice */
 	UPROPERTY(VisibleInstanceOnly, BlueprintReadOnly, Category = "GAS|Abilities")
 	bool bStartupAbilitiesGiven = false;
@@ -67,18 +85,53 @@ protected:
 	UPROPERTY(ReplicatedUsing = OnRep_Death, BlueprintReadOnly, Category = "Health")
 	bool bIsDead = false;
 
+	/** Seconds the ragdoll stays before OnCorpseExpired */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Health")
+	float CorpseLifetime = 8.0f;
+
+	// Mesh setup captured at BeginPlay so ragdoll can be undone (pooling / revive)
+	FTransform DefaultMeshRelativeTransform;
+	FName DefaultMeshCollisionProfile;
+
+	FTimerHandle CorpseTimerHandle;
+
+	// ASC attribute change delegates; publish to UShooterCombatEventSubsystem
+	void OnHealthAttributeChanged(const FOnAttributeChangeData& Data);
+	void OnMaxHealthAttributeChanged(const FOnAttributeChangeData& Data);
+	void PublishHealthChanged(float OldHealth, float NewHealth, float MaxHealth, AActor* EffectInstigator);
+
+	/** Called when the corpse lifetime elapses. Default destroys the actor. */
+	virtual void OnCorpseExpired();
+
 	// --- GAS setup ---
-	/** Grants shared startup abilities (fire, etc.) */
+	/** Grants shared startup abilities (fire, melee, dash) and caches their spec handles */
 	virtual void GrantStartupAbilities();
 
+	/** Gives a startup ability tagged with AbilityTag and returns its handle */
+	FGameplayAbilitySpecHandle GiveStartupAbility(TSubclassOf<UGameplayAbility> AbilityClass, const FGameplayTag& AbilityTag);
+
+	bool TryActivateAbilityHandle(const FGameplayAbilitySpecHandle& Handle);
+
 public:
 	// --- Lifecycle ---
 	virtual void BeginPlay() override;
 	virtual void PossessedBy(AController* NewController) override;
+	virtual void TickActor(float DeltaTime, ELevelTick TickType, FActorTickFunction& ThisTickFunction) override;
 
 	UFUNCTION(BlueprintPure, Category = "Shooter|Weapons")
 	AShooterWeaponBase* GetEquippedWeapon() const { return EquippedWeapon; }
 
+	// --- Ability activation (by cached handle) ---
+	bool TryActivateFireAbility();
+
+	/** False until the fire ability was granted at startup */
+	bool HasFireAbilityHandle() const { return FireAbilityHandle.IsValid(); }
+
+	/** Activates the melee ability, or Fire when no dedicated melee ability was granted */
+	bool TryActivateMeleeAbility();
+
+	bool TryActivateDashAbility();
+
 	// --- Combat / Health ---
 	UFUNCTION(BlueprintPure)
 	float GetHealth() const;
@@ -92,6 +145,7 @@ public:
 	UFUNCTION()
 	void OnOutOfHealth();
 
+	/** The single death check (authority), fed by the ASC health change delegate */
 	UFUNCTION()
 	void HandleHealthChanged(float NewHealth, float MaxHealth);
 
@@ -101,6 +155,30 @@ public:
 	UFUNCTION()
 	void OnRep_Death();
 
+	/** Server: broadcast once when this character dies */
+	UPROPERTY(BlueprintAssignable, Category = "Health")
+	FShooterCharacterDiedSignature OnDied;
+
+	/** Undoes ragdoll/collision/movement changes made by HandleDeath and clears bIsDead */
+	virtual void ResetDeathState();
+
+	// --- Corpse (driven by UShooterCorpseSubsystem) ---
+	/** Switches the mesh to a simulated ragdoll */
+	void StartRagdoll();
+
+	/** Stops simulation and holds the current pose */
+	void FreezeRagdoll();
+
+	/** Hides the corpse early (local visual cleanup); OnCorpseExpired still runs when CorpseLifetime elapses */
+	void FinishCorpse();
+
+	/** Cosmetic fade hook (dissolve material etc.), called before FinishCorpse */
+	UFUNCTION(BlueprintImplementableEvent, Category = "Health")
+	void OnCorpseFade(float FadeDuration);
+
+	/** Server: restores full health and clears active effects, loose tags and running abilities */
+	void ResetCombatState();
+
 	// --- Weapon handling ---
 	UFUNCTION(BlueprintCallable, Category = "Shooter|Weapons")
 	void SpawnDefaultWeapon();
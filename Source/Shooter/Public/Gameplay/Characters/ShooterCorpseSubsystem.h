@@ -0,0 +1,61 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "ShooterCorpseSubsystem.generated.h"
+
+class AShooterCombatCharacter;
+
+enum class EShooterCorpseState : uint8
+{
+    PendingRagdoll,
+    Simulating,
+    Frozen,
+    Fading,
+};
+
+struct FShooterCorpse
+{
+    TWeakObjectPtr<AShooterCombatCharacter> Character;
+    EShooterCorpseState State = EShooterCorpseState::PendingRagdoll;
+    float SimulatedTime = 0.f;
+    float SettledTime = 0.f;
+    float FadeRemaining = 0.f;
+};
+
+/**
+ * Budgets ragdoll physics for dead characters (not created on dedicated servers).
+ *
+ *  - New corpses start simulating a few per frame (colosseum.Corpse.MaxStartsPerFrame).
+ *  - At most colosseum.Corpse.MaxSimulated ragdolls simulate; the oldest is frozen to make room.
+ *  - Ragdolls that settle (or simulate too long) freeze into a static pose.
+ *  - Beyond colosseum.Corpse.MaxCorpses the oldest corpses fade and are hidden early; the
+ *    actor itself is still recycled/destroyed by its own corpse lifetime timer.
+ *
+ * Corpses are kept oldest-first.
+ */
+UCLASS()
+class SHOOTER_API UShooterCorpseSubsystem : public UTickableWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+    virtual void Deinitialize() override;
+
+    // --- FTickableGameObject ---
+    virtual void Tick(float DeltaTime) override;
+    virtual TStatId GetStatId() const override;
+
+    void RegisterCorpse(AShooterCombatCharacter* Character);
+    void UnregisterCorpse(AShooterCombatCharacter* Character);
+
+    int32 GetNumCorpses() const { return Corpses.Num(); }
+    int32 GetNumSimulating() const;
+
+protected:
+    void FreezeCorpse(FShooterCorpse& Corpse);
+    void BeginFade(FShooterCorpse& Corpse);
+
+    TArray<FShooterCorpse> Corpses;
+};
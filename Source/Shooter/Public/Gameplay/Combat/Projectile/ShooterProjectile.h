@@ -3,6 +3,7 @@
 #include "CoreMinimal.h"
 #include "GameFramework/Actor.h"
 #include "ProjectileConfig.h"
+#include "ShooterProjectileRepState.h"
 #include "ShooterProjectile.generated.h"
 
 class USphereComponent;
@@ -28,7 +29,10 @@ public:
     void OnPooledActivate(const FVector& SpawnLocation, const FVector& Direction, AController* InstigatorController, AActor* InstigatorActor);
     void OnPooledDeactivate();
 
-    bool IsActive() const { return bIsActive; }
+    bool IsActive() const { return RepState.bIsActive; }
+
+    /** Seconds since launch; clients derive it from the replicated launch stamp */
+    float GetFlightTime() const;
 
 protected:
     virtual void BeginPlay() override;
@@ -36,6 +40,12 @@ protected:
     UFUNCTION()
     void OnProjectileHit(const FHitResult& Hit);
 
+    UFUNCTION()
+    void OnRep_RepState();
+
+    /** Client: places the projectile on its launch arc at the current flight time */
+    void SimulateFromRepState();
+
     void ApplyDamage(const FHitResult& Hit);
     void SpawnImpactFX(const FHitResult& Hit);
     void UpdateTracerFX();
@@ -47,18 +57,14 @@ protected:
     UPROPERTY(VisibleAnywhere, Category = "Components")
     UNiagaraComponent* TracerComponent;
 
-    UPROPERTY(Replicated)
-    FVector_NetQuantize Velocity;
-
-    UPROPERTY(Replicated)
-    FVector_NetQuantize10 StartLocation;
+    // Launch snapshot; the only replicated projectile state
+    UPROPERTY(ReplicatedUsing = OnRep_RepState)
+    FShooterProjectileRepState RepState;
 
-    UPROPERTY(Replicated)
+    // Server flight state, advanced every tick
+    FVector Velocity;
     float ElapsedLifeTime;
 
-    UPROPERTY(Replicated)
-    bool bIsActive;
-
     // Not replicated; config should be identical across clients
     FProjectileConfig Config;
 
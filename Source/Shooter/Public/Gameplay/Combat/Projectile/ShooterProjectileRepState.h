@@ -0,0 +1,56 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ShooterProjectileRepState.generated.h"
+
+/**
+ * Replicated launch state of a pooled projectile, sent as one quantized blob.
+ *
+ * Only written on activate/deactivate: flight time and the gravity arc follow from the launch,
+ * so per-tick state stays on the server and clients integrate the same arc locally.
+ *
+ *  - 1 bit active flag; inactive projectiles send nothing else.
+ *  - Start location at 0.1 cm (packed like FVector_NetQuantize10).
+ *  - Launch velocity as 16-bit yaw + 16-bit pitch plus a packed whole cm/s speed.
+ *  - Launch time as server milliseconds wrapped to 16 bits (flight times up to ~65 s).
+ *  - Gravity scale behind a 1-bit flag (pool configs vary per launch and are not replicated).
+ */
+USTRUCT()
+struct SHOOTER_API FShooterProjectileRepState
+{
+    GENERATED_BODY()
+
+    UPROPERTY()
+    FVector StartLocation = FVector::ZeroVector;
+
+    UPROPERTY()
+    FVector LaunchVelocity = FVector::ZeroVector;
+
+    UPROPERTY()
+    uint16 LaunchTimeMs = 0;
+
+    UPROPERTY()
+    float GravityScale = 0.f;
+
+    UPROPERTY()
+    bool bIsActive = false;
+
+    static uint16 PackTimeMs(double ServerSeconds);
+
+    /** Seconds since launch for a server time, from the wrapped launch stamp */
+    float GetFlightTime(double ServerSeconds) const;
+
+    /** Position on the launch arc after FlightTime seconds under WorldGravityZ */
+    FVector GetLocationAt(float FlightTime, float WorldGravityZ) const;
+
+    bool NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess);
+};
+
+template<>
+struct TStructOpsTypeTraits<FShooterProjectileRepState> : public TStructOpsTypeTraitsBase2<FShooterProjectileRepState>
+{
+    enum
+    {
+        WithNetSerializer = true,
+    };
+};
@@ -0,0 +1,13 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/EngineTypes.h"
+
+namespace ShooterCollision
+{
+    /**
+     * "ArenaCombat" trace channel (DefaultEngine.ini). Ignored by default; only primitives
+     * registered with UShooterArenaCollisionSubsystem (arena collision proxies, live combatants) block it.
+     */
+    static constexpr ECollisionChannel ArenaCombat = ECC_GameTraceChannel2;
+}
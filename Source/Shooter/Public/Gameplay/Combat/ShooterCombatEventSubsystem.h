@@ -0,0 +1,78 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "ShooterCombatEventSubsystem.generated.h"
+
+class AShooterCombatCharacter;
+
+/** One health change, clamped to [0, MaxHealth] */
+USTRUCT(BlueprintType)
+struct FShooterHealthEvent
+{
+    GENERATED_BODY()
+
+    UPROPERTY(BlueprintReadOnly, Category = "Health")
+    AShooterCombatCharacter* Character = nullptr;
+
+    // Original instigator of the executed effect; only known on the server
+    UPROPERTY(BlueprintReadOnly, Category = "Health")
+    AActor* Instigator = nullptr;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Health")
+    float OldHealth = 0.f;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Health")
+    float NewHealth = 0.f;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Health")
+    float MaxHealth = 0.f;
+
+    float GetOldFraction() const { return MaxHealth > 0.f ? OldHealth / MaxHealth : 1.f; }
+    float GetNewFraction() const { return MaxHealth > 0.f ? NewHealth / MaxHealth : 1.f; }
+
+    /** True when this change took health from at/above Fraction to below it */
+    bool CrossedBelow(float Fraction) const { return GetOldFraction() >= Fraction && GetNewFraction() < Fraction; }
+};
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FShooterHealthEventSignature, const FShooterHealthEvent&, Event);
+
+/**
+ * Combat event bus: one place where health changes are published and observed.
+ *
+ * Combat characters publish from their ASC's Health/MaxHealth value-change delegates, so every change
+ * (effects, SetNumericAttributeBase, replication on clients) arrives exactly once and nobody polls
+ * attributes. AI, UI and arena logic subscribe instead of looking up ASCs.
+ *
+ * Also the damage-throughput probe: colosseum.Combat.DamageReport / colosseum.Combat.DamageReset and the
+ * ShooterCombat stat group and CSV category.
+ */
+UCLASS()
+class SHOOTER_API UShooterCombatEventSubsystem : public UWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+
+    void PublishHealthChanged(const FShooterHealthEvent& Event);
+
+    /** Every health (or max health) change */
+    UPROPERTY(BlueprintAssignable, Category = "Combat")
+    FShooterHealthEventSignature OnHealthChanged;
+
+    /** Health reached zero (the zero threshold crossing) */
+    UPROPERTY(BlueprintAssignable, Category = "Combat")
+    FShooterHealthEventSignature OnHealthDepleted;
+
+    void ResetDamageStats();
+    void LogDamageReport() const;
+
+protected:
+    // Throughput since the last reset
+    double StatsStartTime = 0.0;
+    int32 NumDamageEvents = 0;
+    int32 NumDepleted = 0;
+    double TotalDamage = 0.0;
+    double TotalHealing = 0.0;
+};
@@ -48,6 +48,9 @@ public:
 	UFUNCTION(BlueprintPure, Category = "Shooter|Weapon")
 	const FGameplayTag& GetCurrentFireModeTag() const { return CurrentFireModeTag; }
 
+	/** Server: stops firing and restores the class default fire mode and reload state (pooled/respawned wielders). */
+	virtual void ResetWeaponState();
+
 protected:
 	virtual void BeginPlay() override;
 	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
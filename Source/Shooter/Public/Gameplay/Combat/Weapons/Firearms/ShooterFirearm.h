@@ -79,6 +79,11 @@ protected:
 	virtual void HandleFire_Internal() override;
 	virtual void HandleStopFire_Internal() override;
 
+public:
+	virtual void ResetWeaponState() override;
+
+protected:
+
 	void BeginAutoIfNeeded();     // set timer if Auto/Burst
 	void ClearFireTimers();
 
@@ -20,6 +20,17 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Gameplay")
 	void RequestRespawn(AController* Controller);
 
+	virtual void InitGame(const FString& MapName, const FString& Options, FString& ErrorMessage) override;
+	virtual void HandleStartingNewPlayer_Implementation(APlayerController* NewPlayer) override;
+	virtual void Logout(AController* Exiting) override;
+
+	/** Revives Controller's dead AShooterCharacter at a player start, keeping the pawn. False if it could not. */
+	bool RevivePlayer(AController* Controller);
+
 protected:
+	/** Host many solo runs in this server world (also -HostRuns / ?HostRuns). See UShooterRunHostSubsystem. */
+	UPROPERTY(EditDefaultsOnly, Category = "Hosting")
+	bool bHostConcurrentRuns = false;
+
 	void RespawnPlayer(AController* Controller);
 };
@@ -28,10 +28,11 @@ public:
 protected:
 
     virtual void BeginPlay() override;
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
 public:
 
-    // Whether this object can currently be interacted with
+    // Whether this object can currently be interacted with (change it through SetInteractable so the registry follows)
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Interact")
     bool bIsInteractable;
 
@@ -59,7 +60,7 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Interact")
     virtual bool Interact(AActor* InteractingActor);
 
-    // Enables or disables interaction at runtime
+    // Enables or disables interaction at runtime; disabled interactables leave UInteractableRegistrySubsystem
     UFUNCTION(BlueprintCallable, Category = "Interact")
     void SetInteractable(bool bNewState);
 };
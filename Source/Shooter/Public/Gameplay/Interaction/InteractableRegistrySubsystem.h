@@ -0,0 +1,61 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "UObject/ObjectKey.h"
+#include "InteractableRegistrySubsystem.generated.h"
+
+class UInteractableComponent;
+class USceneComponent;
+
+/**
+ * Spatial hash (XY cells) of the interactables that are currently usable.
+ *
+ * UInteractableComponent registers on BeginPlay / SetInteractable(true) and leaves on EndPlay /
+ * SetInteractable(false); movable owners are re-hashed when their root moves. Players, AI and
+ * server-side validation query it instead of tracing.
+ */
+UCLASS()
+class SHOOTER_API UInteractableRegistrySubsystem : public UWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    virtual void Deinitialize() override;
+
+    void Register(UInteractableComponent* Interactable);
+    void Unregister(UInteractableComponent* Interactable);
+
+    bool IsRegistered(const UInteractableComponent* Interactable) const;
+
+    /** Closest registered interactable within Radius that Interactor may use */
+    UFUNCTION(BlueprintCallable, Category = "Interact")
+    UInteractableComponent* FindNearestInteractable(const FVector& Location, float Radius, AActor* Interactor) const;
+
+    /** True if any interactable is registered within Radius (ignores CanInteract) */
+    bool HasInteractableWithin(const FVector& Location, float Radius) const;
+
+    /** Server check for a client request: registered, in range of Interactor and usable by it */
+    bool IsUsableBy(const UInteractableComponent* Interactable, const AActor* Interactor, float Radius) const;
+
+    int32 GetNumRegistered() const { return CellByInteractable.Num(); }
+
+    static constexpr float CellSize = 1000.f;
+
+protected:
+    static FIntPoint GetCell(const FVector& Location);
+
+    template <typename Func>
+    void ForEachInRadius(const FVector& Location, float Radius, Func&& Visit) const;
+
+    void AddToCell(UInteractableComponent* Interactable, const FIntPoint& Cell);
+    void RemoveFromCell(const UInteractableComponent* Interactable, const FIntPoint& Cell);
+
+    void OnOwnerTransformUpdated(USceneComponent* Root, EUpdateTransformFlags Flags, ETeleportType Teleport);
+
+    TMap<FIntPoint, TArray<TWeakObjectPtr<UInteractableComponent>>> Cells;
+    TMap<TObjectKey<UInteractableComponent>, FIntPoint> CellByInteractable;
+
+    // Movable owners we listen to, keyed by their root component
+    TMap<TObjectKey<USceneComponent>, FDelegateHandle> MoveHandles;
+};
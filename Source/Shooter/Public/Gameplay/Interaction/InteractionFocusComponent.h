@@ -0,0 +1,75 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/ActorComponent.h"
+#include "Engine/EngineTypes.h"
+#include "WorldCollision.h"
+#include "InteractionFocusComponent.generated.h"
+
+class UInteractableComponent;
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnInteractFocusChanged, UInteractableComponent*, NewFocus);
+
+/**
+ * Tracks the interactable the local player is looking at.
+ *
+ * Locally controlled pawns issue one async line trace every colosseum.Interact.FocusFrameInterval frames
+ * and cache the hit's UInteractableComponent (looked up only when the hit actor changes), so prompts
+ * can read GetFocusedInteractable() every frame for free and UAbil_Interact validates against the cache.
+ * The trace is skipped when UInteractableRegistrySubsystem has nothing registered in reach. Non-local
+ * owners (the server for remote players, bots) do not trace; UAbil_Interact queries the registry instead.
+ */
+UCLASS(ClassGroup = (Custom), meta = (BlueprintSpawnableComponent))
+class SHOOTER_API UInteractionFocusComponent : public UActorComponent
+{
+    GENERATED_BODY()
+
+public:
+    UInteractionFocusComponent();
+
+    virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
+
+    /** Cached focus (may be up to a few frames old); nullptr if nothing interactable is in view */
+    UFUNCTION(BlueprintPure, Category = "Interact")
+    UInteractableComponent* GetFocusedInteractable() const { return FocusedInteractable.Get(); }
+
+    /** Distance from the view point to the focused hit */
+    UFUNCTION(BlueprintPure, Category = "Interact")
+    float GetFocusDistance() const { return FocusDistance; }
+
+    /** True if the owner is the locally controlled player, i.e. the cached focus is live */
+    bool IsLocalViewer() const;
+
+    UPROPERTY(BlueprintAssignable, Category = "Interact")
+    FOnInteractFocusChanged OnFocusChanged;
+
+    // Interaction reach; UAbil_Interact validates against the same value
+    UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Interact")
+    float TraceDistance = 250.f;
+
+    UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Interact")
+    TEnumAsByte<ECollisionChannel> TraceChannel = ECC_Visibility;
+
+    // Half-size of the largest interactable; the registry is queried within TraceDistance + this around the view
+    UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Interact")
+    float MaxInteractableExtent = 300.f;
+
+protected:
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
+    bool GetTraceSegment(FVector& OutStart, FVector& OutEnd) const;
+    bool AnyInteractableInReach(const FVector& ViewLocation) const;
+
+    void RequestAsyncTrace();
+    void OnAsyncTraceDone(const FTraceHandle& Handle, FTraceDatum& Data);
+
+    void SetFocus(AActor* HitActor, float Distance);
+
+    TWeakObjectPtr<UInteractableComponent> FocusedInteractable;
+    TWeakObjectPtr<AActor> FocusedActor;
+    float FocusDistance = 0.f;
+
+    FTraceDelegate TraceDelegate;
+    FTraceHandle PendingTrace;
+    uint32 FramesUntilQuery = 0;
+};
@@ -0,0 +1,49 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "ShooterNetRelevancySubsystem.generated.h"
+
+class AShooterCombatCharacter;
+
+/**
+ * Server-side replication policy for combat pawns: adapts each AI pawn's NetUpdateFrequency to its
+ * distance from the nearest player and whether it is doing anything. Living player pawns always keep
+ * their authored rate.
+ *
+ *  - Near (colosseum.Net.NearDistance) and moving: the pawn's authored rate.
+ *  - Mid range: half, far (colosseum.Net.FarDistance): a fifth; idle pawns drop one more band.
+ *  - Dead or pooled (hidden) pawns: colosseum.Net.InactiveRate.
+ *
+ * The rest of the policy lives on the actors: pedestals and pooled projectiles go dormant,
+ * weapons use their owner's relevancy, projectiles have a short cull distance.
+ */
+UCLASS()
+class SHOOTER_API UShooterNetRelevancySubsystem : public UTickableWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    // --- FTickableGameObject ---
+    virtual void Tick(float DeltaTime) override;
+    virtual TStatId GetStatId() const override;
+
+    /** Server: called by combat characters on BeginPlay */
+    void RegisterPawn(AShooterCombatCharacter* Pawn);
+
+protected:
+    struct FPawnEntry
+    {
+        TWeakObjectPtr<AShooterCombatCharacter> Pawn;
+
+        // Rates the pawn was authored with
+        float BaseRate = 100.f;
+        float BaseMinRate = 2.f;
+    };
+
+    void UpdateRates();
+
+    TArray<FPawnEntry> Pawns;
+
+    float TimeUntilUpdate = 0.f;
+};
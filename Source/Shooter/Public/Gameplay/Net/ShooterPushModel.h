@@ -0,0 +1,31 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Net/Core/PushModel/PushModel.h"
+
+/**
+ * Push-model replication for the Shooter module.
+ *
+ * Every replicated Shooter property is registered with bIsPushBased, so the net driver only compares it
+ * after a writer marks it dirty. Writers use SHOOTER_MARK_DIRTY (attribute sets mark from
+ * PostAttributeChange); in non-shipping builds each mark is also recorded for
+ * colosseum.Net.ValidatePushModel, which reports replicated values that changed without one.
+ */
+#define SHOOTER_PUSH_MODEL_VALIDATION !UE_BUILD_SHIPPING
+
+namespace ShooterPushModel
+{
+#if SHOOTER_PUSH_MODEL_VALIDATION
+    /** Notes a dirty mark for the validator; no-op unless a validation run is active */
+    SHOOTER_API void RecordDirty(const UObject* Object, FName PropertyName);
+#else
+    FORCEINLINE void RecordDirty(const UObject* Object, FName PropertyName) {}
+#endif
+}
+
+#define SHOOTER_MARK_DIRTY(ClassName, PropertyName, Object) \
+    do \
+    { \
+        MARK_PROPERTY_DIRTY_FROM_NAME(ClassName, PropertyName, Object); \
+        ShooterPushModel::RecordDirty(Object, GET_MEMBER_NAME_CHECKED(ClassName, PropertyName)); \
+    } while (0)
@@ -6,12 +6,21 @@
 #include "GameplayTagContainer.h"
 #include "RunArenaData.generated.h"
 
+class AShooterAICharacter;
+class UNiagaraSystem;
+class USoundBase;
+
 UCLASS(BlueprintType)
-class SHOOTER_API URunArenaData : public UDataAsset
+class SHOOTER_API URunArenaData : public UPrimaryDataAsset
 {
     GENERATED_BODY()
 
 public:
+    // Asset bundle names prefetched by the run director one arena ahead
+    static const FName EnemiesBundle;
+    static const FName FXBundle;
+    static const FName AudioBundle;
+
     // Arena map to load (soft reference for async streaming)
     UPROPERTY(EditAnywhere, BlueprintReadOnly)
     TSoftObjectPtr<UWorld> ArenaLevel;
@@ -26,4 +35,15 @@ public:
 
     UPROPERTY(EditAnywhere, BlueprintReadOnly)
     bool bIsFinalArena = false;
+
+    // Enemy classes this arena spawns (their weapons, bullet data and montages come along as hard refs)
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Prefetch", meta = (AssetBundles = "Enemies"))
+    TArray<TSoftClassPtr<AShooterAICharacter>> EnemyArchetypes;
+
+    // Niagara systems used by the arena or its enemies that are not hard-referenced by the classes above
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Prefetch", meta = (AssetBundles = "FX"))
+    TArray<TSoftObjectPtr<UNiagaraSystem>> FXAssets;
+
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Prefetch", meta = (AssetBundles = "Audio"))
+    TArray<TSoftObjectPtr<USoundBase>> AudioAssets;
 };
@@ -3,12 +3,25 @@
 #include "CoreMinimal.h"
 #include "Subsystems/GameInstanceSubsystem.h"
 #include "GameplayTagContainer.h"
+#include "UObject/PrimaryAssetId.h"
+#include "Gameplay/Run/RunSnapshot.h"
 #include "RunDirector.generated.h"
 
 class URunDirectorConfig;
 class URunArenaData;
 class AShooterCharacter;
+class UAbilitySystemComponent;
+class ULevelStreamingDynamic;
 struct FGameplayEventData;
+struct FStreamableHandle;
+
+/** Asset bundles of one arena being (or already) prefetched */
+struct FRunArenaPrefetch
+{
+    TSharedPtr<FStreamableHandle> Handle;
+    FPrimaryAssetId AssetId;
+    int64 ResourceBytes = 0;
+};
 
 UCLASS(BlueprintType, Blueprintable)
 class SHOOTER_API URunDirector : public UGameInstanceSubsystem
@@ -31,6 +44,42 @@ public:
     void OnArenaLevelLoaded(UWorld* LoadedWorld);
     void OnArenaCleared(const FGameplayEventData* Payload);
 
+    // Reward pedestals are up: stream the next arena in while the player chooses
+    void OnArenaRewardSpawned(const FGameplayEventData* Payload);
+
+    /** Starts loading ArenaSequence[Index] in the background without showing it */
+    void PreloadArena(int32 Index);
+
+    /** Async-loads the enemy/FX/audio bundles of ArenaSequence[Index] through the asset manager */
+    void PrefetchArenaBundles(int32 Index);
+
+    /** Releases bundles of every arena before Index (already completed) */
+    void EvictArenaBundlesBefore(int32 Index);
+
+    /** Approximate resident size of all prefetched arena bundles */
+    int64 GetPrefetchedBytes() const;
+
+    // --- Run snapshot (resume) ---
+    /** Captures the run and player state and writes it on a worker thread; no-op outside a run */
+    void SaveRunSnapshotAsync();
+
+    /** From entering a run's first arena until the run returns to the hub */
+    bool IsRunInProgress() const { return bRunInProgress; }
+
+    /** True once the boot-time snapshot read found a run to resume */
+    bool HasResumableRun() const { return bHasResumableRun; }
+
+    /** Continues the stored run at its next arena (deferred while the config loads); player state is restored when the arena starts */
+    void ResumeRun();
+
+    int32 GetDifficultyTier() const { return CurrentDifficultyTier; }
+
+    /** Seeded per run so resumed runs replay the same rolls */
+    FRandomStream& GetRunRandom() { return RunRandom; }
+
+    /** Stable seed for the current arena, independent of how many rolls earlier arenas made */
+    int32 GetArenaSeed() const { return (int32)HashCombine((uint32)RunSeed, (uint32)CurrentArenaIndex); }
+
     UPROPERTY(EditDefaultsOnly, Category = "Config")
     TSoftObjectPtr<URunDirectorConfig> ConfigAsset;
 
@@ -38,6 +87,62 @@ public:
     TArray<URunArenaData*> ArenaSequence;
 
 private:
+    void OnConfigLoaded();
+
+    bool UsesArenaStreaming() const { return !RunPersistentLevel.IsNull(); }
+
+    ULevelStreamingDynamic* RequestArenaStreaming(int32 Index);
+    void ShowStreamedArena(int32 Index);
+    void ReleaseArenaStreaming(ULevelStreamingDynamic* Streaming);
+    void ReleaseAllArenaStreaming();
+
+    UFUNCTION()
+    void OnStreamedArenaShown();
+
+    /** Hands arena data to the ArenaManager in Level (or the whole world if null) and starts it */
+    bool StartArenaInLevel(UWorld* World, ULevel* Level);
+
+    void OnArenaBundlesLoaded(int32 Index);
+
+    void CaptureRunSnapshot(FRunSnapshot& OutSnapshot) const;
+    void ApplySnapshotToPlayer(const FRunSnapshot& Snapshot);
+    void DeleteRunSnapshot();
+
+    /** Shared by StartNewRun and ResumeRun once indices are set */
+    void EnterRunAtCurrentArena();
+
+    FRunSnapshot ResumeSnapshot;
+    bool bHasResumableRun = false;
+    bool bApplyResumeOnArenaStart = false;
+    bool bRunInProgress = false;
+
+    int32 RunSeed = 0;
+    FRandomStream RunRandom;
+
+    // Keyed by ArenaSequence index
+    TMap<int32, FRunArenaPrefetch> ArenaPrefetches;
+
+    TSharedPtr<FStreamableHandle> ConfigLoadHandle;
+    bool bStartRunWhenConfigLoaded = false;
+    bool bResumeRunWhenConfigLoaded = false;
+
+    TSoftObjectPtr<UWorld> RunPersistentLevel;
+
+    // Streaming arena currently shown, and the next one loading in the background
+    UPROPERTY()
+    TObjectPtr<ULevelStreamingDynamic> ActiveArenaStreaming;
+
+    UPROPERTY()
+    TObjectPtr<ULevelStreamingDynamic> PreloadedArenaStreaming;
+
+    int32 PreloadedArenaIndex = INDEX_NONE;
+
+    // True between StartNewRun's travel to the run map and the first arena being streamed
+    bool bAwaitingRunMap = false;
+
+    // ASC the run events are bound to (the pawn survives arena swaps when streaming)
+    TWeakObjectPtr<UAbilitySystemComponent> BoundASC;
+
     AShooterCharacter* PlayerRef = nullptr;
 
     int32 CurrentArenaIndex = 0;
@@ -7,6 +7,7 @@
 #include "RunDirectorConfig.generated.h"
 
 class URunArenaData;
+class UWorld;
 
 /**
  * 
@@ -19,4 +20,9 @@ class SHOOTER_API URunDirectorConfig : public UDataAsset
 public:
     UPROPERTY(EditAnywhere, BlueprintReadOnly)
     TArray<URunArenaData*> ArenaSequence;
+
+    // Persistent map a run travels to once; arenas are streamed into it as level instances.
+    // Leave empty to fall back to a full OpenLevel per arena.
+    UPROPERTY(EditAnywhere, BlueprintReadOnly)
+    TSoftObjectPtr<UWorld> RunPersistentLevel;
 };
\ No newline at end of file
@@ -0,0 +1,66 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameplayTagContainer.h"
+
+/** Augment entry as stored on disk (effect class by path so the snapshot has no hard refs) */
+struct FRunSnapshotAugment
+{
+    FString DisplayName;
+    FGameplayTag AugmentTag;
+    FSoftClassPath EffectClass;
+
+    bool operator==(const FRunSnapshotAugment& Other) const
+    {
+        return DisplayName == Other.DisplayName && AugmentTag == Other.AugmentTag && EffectClass == Other.EffectClass;
+    }
+};
+
+/**
+ * Compact, versioned binary snapshot of an in-progress run.
+ *
+ * Layout: magic, version, then fields in declaration order. New fields are appended and
+ * read only when the stored version is new enough, so older snapshots stay loadable.
+ */
+struct SHOOTER_API FRunSnapshot
+{
+    enum EVersion : uint16
+    {
+        Initial = 1,
+
+        LatestPlusOne,
+        Latest = LatestPlusOne - 1
+    };
+
+    static constexpr uint32 Magic = 0x4E555243; // "CRUN"
+
+    int32 RunIndex = 0;
+    int32 ArenaIndex = 0;
+    int32 DifficultyTier = 1;
+    int32 RandomSeed = 0;
+
+    float Health = 0.f;
+    float Stamina = 0.f;
+
+    TArray<FRunSnapshotAugment> Augments;
+
+    bool operator==(const FRunSnapshot& Other) const;
+
+    /** Serializes to/from Ar. Returns false on a bad header or a version newer than Latest. */
+    bool Serialize(FArchive& Ar);
+
+    bool SaveToBytes(TArray<uint8>& OutBytes) const;
+    bool LoadFromBytes(const TArray<uint8>& Bytes);
+
+    static FString GetDefaultPath();
+
+    // File IO below is serialized on one task pipe and runs in call order
+
+    /** Serializes on the calling thread (cheap) and writes the file on a worker thread */
+    void WriteAsync(const FString& Path, TFunction<void(bool)> OnComplete) const;
+
+    /** Reads and parses the file on a worker thread; OnComplete runs on the game thread */
+    static void ReadAsync(const FString& Path, TFunction<void(bool, const FRunSnapshot&)> OnComplete);
+
+    static void DeleteAsync(const FString& Path);
+};
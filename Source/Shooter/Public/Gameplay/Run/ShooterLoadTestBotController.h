@@ -0,0 +1,57 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "AIController.h"
+#include "ShooterLoadTestBotController.generated.h"
+
+class AArenaManager;
+class AShooterCharacter;
+class UInteractableComponent;
+
+/**
+ * Scripted driver for the pawns of colosseum.Host.LoadTest runs (server only, no behavior tree).
+ *
+ * Every ThinkInterval it targets the nearest living enemy of its run's arena, closes in, faces it and
+ * fires through the pawn's fire ability. Once the arena is cleared it walks to the nearest usable
+ * augment pedestal and activates the interact ability, so simulated runs fight, pick rewards and move
+ * on like players do. Moves without a navmesh path fall back to steering straight at the target.
+ */
+UCLASS()
+class SHOOTER_API AShooterLoadTestBotController : public AAIController
+{
+    GENERATED_BODY()
+
+public:
+    AShooterLoadTestBotController();
+
+    virtual void Tick(float DeltaSeconds) override;
+
+protected:
+    void Think();
+
+    /** Nearest living enemy of Manager's wave, if any */
+    AActor* FindEnemy(const AArenaManager& Manager, const AShooterCharacter& Bot) const;
+
+    void EngageEnemy(AShooterCharacter& Bot, AActor* Enemy);
+    void UseInteractable(AShooterCharacter& Bot, UInteractableComponent* Interactable);
+
+    void MoveTowards(AActor* NewTarget, float AcceptanceRadius);
+    void ClearTarget();
+
+    UPROPERTY(EditDefaultsOnly, Category = "LoadTest")
+    float ThinkInterval = 0.25f;
+
+    // Bots fire from within this distance when they have line of sight
+    UPROPERTY(EditDefaultsOnly, Category = "LoadTest")
+    float EngageDistance = 1500.f;
+
+    // Pedestals are looked up within this radius of the bot once the arena is cleared
+    UPROPERTY(EditDefaultsOnly, Category = "LoadTest")
+    float InteractableSearchRadius = 5000.f;
+
+    TWeakObjectPtr<AActor> MoveTarget;
+    float MoveAcceptanceRadius = 0.f;
+    bool bSteerDirectly = false;
+
+    double NextThinkTime = 0.0;
+};
@@ -0,0 +1,181 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Engine/EngineBaseTypes.h"
+#include "Engine/TimerHandle.h"
+#include "UObject/ObjectKey.h"
+#include "ShooterRunHostSubsystem.generated.h"
+
+class AArenaManager;
+class AController;
+class AShooterCharacter;
+class UAbilitySystemComponent;
+class ULevelStreamingDynamic;
+struct FGameplayEventData;
+
+enum class EShooterHostedRunState : uint8
+{
+    WaitingForConfig,
+    StreamingArena,
+    InArena,
+};
+
+/** One solo run hosted by this server process */
+USTRUCT()
+struct FShooterHostedRun
+{
+    GENERATED_BODY()
+
+    int32 RunId = INDEX_NONE;
+
+    // Arena instances of this run are streamed at this offset so runs never overlap
+    int32 Slot = INDEX_NONE;
+    FVector Origin = FVector::ZeroVector;
+
+    TWeakObjectPtr<AController> Controller;
+    TWeakObjectPtr<AShooterCharacter> Player;
+    TWeakObjectPtr<UAbilitySystemComponent> BoundASC;
+    FDelegateHandle ArenaClearedHandle;
+
+    UPROPERTY()
+    TObjectPtr<ULevelStreamingDynamic> Streaming;
+
+    TWeakObjectPtr<AArenaManager> Manager;
+
+    EShooterHostedRunState State = EShooterHostedRunState::WaitingForConfig;
+
+    int32 ArenaIndex = 0;
+    int32 RunsCompleted = 0;
+    int32 ArenasCleared = 0;
+    int32 RunSeed = 0;
+
+    // Simulated runs (load test) own their pawn and bot controller
+    bool bSimulated = false;
+
+    // Tick time measured inside this run's FShooterRunTickScopes
+    double MeasuredTickMs = 0.0;
+    double FrameTickMs = 0.0;
+    double PeakTickMs = 0.0;
+    int32 MeasuredFrames = 0;
+};
+
+/**
+ * Hosts many independent solo runs in one server world (enabled by AShooterGameMode::bHostConcurrentRuns,
+ * -HostRuns on the command line, or the load test).
+ *
+ *  - Every run gets its own streamed instance of the current arena, offset on a grid, with its own
+ *    AArenaManager, difficulty tier, seed and player. Enemies target their arena's player only.
+ *  - Arena data comes from URunDirector's config; every arena's bundles are prefetched once and
+ *    stay resident, so all runs share loaded enemy/FX/audio assets (and the enemy pool).
+ *  - Each run's tick cost is measured directly: the arena manager, player and enemy ticks (actor and
+ *    movement) run inside an FShooterRunTickScope that charges the run owning the actor. Actor tick
+ *    time outside those scopes (animation, AI brains, shared actors) is reported as unattributed.
+ *
+ * colosseum.Host.LoadTest <Runs> <Seconds> starts simulated runs, each driven by an
+ * AShooterLoadTestBotController that fights the wave and picks augments, and logs the per-run tick cost.
+ */
+UCLASS()
+class SHOOTER_API UShooterRunHostSubsystem : public UTickableWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    virtual void Deinitialize() override;
+
+    // --- FTickableGameObject ---
+    virtual void Tick(float DeltaTime) override;
+    virtual TStatId GetStatId() const override;
+
+    /** Switches this world to hosting mode (server only); prefetches every arena's bundles */
+    void EnableHosting();
+
+    bool IsHostingRuns() const { return bHosting; }
+
+    /** Starts a fresh run for Controller's pawn at the first arena */
+    void StartRun(AController* Controller, bool bSimulated = false);
+
+    /** Restarts the run owned by Controller (after its player respawned) */
+    void RestartRun(AController* Controller);
+
+    /** Tears the run down; simulated runs also destroy their pawn and controller */
+    void EndRun(AController* Controller);
+
+    /** Spawns NumRuns simulated runs and logs a tick cost report after Seconds */
+    void StartLoadTest(int32 NumRuns, float Seconds);
+
+    void LogTickReport() const;
+
+    int32 GetNumRuns() const { return Runs.Num(); }
+
+    /** Arena manager of the run owned by Controller while it is in an arena, else nullptr */
+    AArenaManager* GetRunArena(const AController* Controller) const;
+
+    /** Hosted run the actor belongs to this frame (manager, player, controller or enemy), else INDEX_NONE */
+    int32 FindRunIdForActor(const AActor* Actor) const;
+
+    /** Adds tick time measured by an FShooterRunTickScope to the run's current frame */
+    void AddRunTickTime(int32 RunId, double Ms);
+
+protected:
+    FShooterHostedRun* FindRun(const AController* Controller);
+
+    void EnterArena(FShooterHostedRun& Run);
+    void StartStreamedArena(FShooterHostedRun& Run);
+    void ReleaseArena(FShooterHostedRun& Run);
+    void BindRunEvents(FShooterHostedRun& Run);
+    void UnbindRunEvents(FShooterHostedRun& Run);
+
+    void OnRunArenaCleared(const FGameplayEventData* Payload, int32 RunId);
+
+    void AcquireSlot(FShooterHostedRun& Run);
+
+    /** Maps this frame's run actors to their run for FShooterRunTickScope lookups */
+    void RebuildActorRunIds();
+
+    void OnWorldTickStart(UWorld* World, ELevelTick TickType, float DeltaSeconds);
+    void OnWorldPostActorTick(UWorld* World, ELevelTick TickType, float DeltaSeconds);
+
+    void FinishLoadTest();
+
+    UPROPERTY()
+    TArray<FShooterHostedRun> Runs;
+
+    TArray<int32> FreeSlots;
+    int32 NextSlot = 0;
+    int32 NextRunId = 0;
+
+    bool bHosting = false;
+    bool bPrefetchedArenas = false;
+
+    // Actor tick timing (world tick start -> post actor tick)
+    double ActorTickStartTime = 0.0;
+    double LastFrameStartTime = 0.0;
+    double TotalActorTickMs = 0.0;
+    double TotalUnattributedTickMs = 0.0;
+    double TotalFrameMs = 0.0;
+    int32 MeasuredFrames = 0;
+
+    TMap<TObjectKey<AActor>, int32> ActorRunIds;
+
+    FTimerHandle LoadTestTimerHandle;
+
+    FDelegateHandle TickStartHandle;
+    FDelegateHandle PostActorTickHandle;
+};
+
+/**
+ * Charges the enclosing scope's time to the hosted run that owns Actor. Placed at the top of
+ * tick functions that never nest (actor tick, movement tick); a no-op unless the world hosts runs.
+ */
+class SHOOTER_API FShooterRunTickScope
+{
+public:
+    explicit FShooterRunTickScope(const AActor* Actor);
+    ~FShooterRunTickScope();
+
+private:
+    UShooterRunHostSubsystem* Host = nullptr;
+    int32 RunId = INDEX_NONE;
+    double StartTime = 0.0;
+};
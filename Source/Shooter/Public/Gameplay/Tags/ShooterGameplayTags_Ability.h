@@ -10,6 +10,7 @@ namespace ShooterTags
 
 	// Weapon verbs
 	UE_DECLARE_GAMEPLAY_TAG_EXTERN(Ability_Weapon_Fire);
+	UE_DECLARE_GAMEPLAY_TAG_EXTERN(Ability_Weapon_Melee);
 	UE_DECLARE_GAMEPLAY_TAG_EXTERN(Ability_Weapon_Reload);
 	UE_DECLARE_GAMEPLAY_TAG_EXTERN(Ability_Weapon_ADS);
 	UE_DECLARE_GAMEPLAY_TAG_EXTERN(Ability_Weapon_Switch);
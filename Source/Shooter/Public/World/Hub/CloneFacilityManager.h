@@ -19,6 +19,7 @@ public:
 
 protected:
     virtual void BeginPlay() override;
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
     // Reference to the reprint pod where the player respawns
     UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Clone Facility")
@@ -16,6 +16,12 @@ class SHOOTER_API AReprintPodActor : public AActor
 public:
     AReprintPodActor();
 
+protected:
+    virtual void BeginPlay() override;
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
+public:
+
     UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
     USceneComponent* Root;
 
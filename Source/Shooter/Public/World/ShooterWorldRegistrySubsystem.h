@@ -0,0 +1,58 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "UObject/ObjectKey.h"
+#include "ShooterWorldRegistrySubsystem.generated.h"
+
+class AArenaManager;
+class AAugmentPedestal;
+class ACloneFacilityManager;
+class AReprintPodActor;
+class ULevel;
+
+/**
+ * Lookup table for run/hub flow actors, filled as they BeginPlay and cleared on EndPlay,
+ * so level load and reward selection never need world-wide actor scans.
+ */
+UCLASS()
+class SHOOTER_API UShooterWorldRegistrySubsystem : public UWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    virtual void Deinitialize() override;
+
+    // --- Arena managers (one per arena level) ---
+    void RegisterArenaManager(AArenaManager* Manager);
+    void UnregisterArenaManager(AArenaManager* Manager);
+
+    /** Manager placed in Level, or any registered manager when Level is null */
+    AArenaManager* FindArenaManager(const ULevel* Level = nullptr) const;
+
+    /** Every live registered manager */
+    void GetArenaManagers(TArray<AArenaManager*>& OutManagers) const;
+
+    // --- Pedestals, grouped by the actor that spawned them ---
+    void RegisterPedestal(AAugmentPedestal* Pedestal);
+    void UnregisterPedestal(AAugmentPedestal* Pedestal);
+
+    /** Live pedestals whose Owner is OwnerActor */
+    void GetPedestalsOwnedBy(const AActor* OwnerActor, TArray<AAugmentPedestal*>& OutPedestals) const;
+
+    // --- Hub ---
+    void RegisterReprintPod(AReprintPodActor* Pod);
+    void UnregisterReprintPod(AReprintPodActor* Pod);
+    AReprintPodActor* GetReprintPod() const { return ReprintPod.Get(); }
+
+    void RegisterFacilityManager(ACloneFacilityManager* Manager);
+    void UnregisterFacilityManager(ACloneFacilityManager* Manager);
+    ACloneFacilityManager* GetFacilityManager() const { return FacilityManager.Get(); }
+
+protected:
+    TMap<TObjectKey<ULevel>, TWeakObjectPtr<AArenaManager>> ArenaManagersByLevel;
+    TMap<TObjectKey<AActor>, TArray<TWeakObjectPtr<AAugmentPedestal>>> PedestalsByOwner;
+
+    TWeakObjectPtr<AReprintPodActor> ReprintPod;
+    TWeakObjectPtr<ACloneFacilityManager> FacilityManager;
+};
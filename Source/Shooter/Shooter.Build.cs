@@ -13,6 +13,7 @@ public class Shooter : ModuleRules
 			"CoreUObject",
 			"Engine",
 			"InputCore",
+			"NetCore",
 			"EnhancedInput",
 			"GameplayAbilities",
 			"GameplayTasks",